@@ -33,6 +33,14 @@ const int& ActionEvent::getRunwayID() const {
     return this->runwayID;
 }
 
+/**
+ * Calculates the theoretical amount of time that planes needed to occupy the runway (see Plane::getServiceTime()).
+ * @return The total time that the clearance may takes.
+ */
+int ActionEvent::calculateTotalTime() const {
+    return this->plane.getServiceTime();
+}
+
 /**
  * Destructor for the event.
  */
@@ -2,8 +2,6 @@
 
 #include "Event.h"
 
-constexpr auto RUNWAY_USAGE = 1; //The amount of time spend on each runway (theoretical).;
-
 class TakeoffEvent;
 class LandingEvent;
 
@@ -42,10 +40,10 @@ class ActionEvent : public Event {
         const int& getRunwayID() const;
 
         /**
-         * Calculates the theoretical amount of time that planes needed to occupy the runway.
+         * Calculates the theoretical amount of time that planes needed to occupy the runway (see Plane::getServiceTime()).
          * @return The total time that the clearance may takes.
          */
-        virtual int calculateTotalTime() = 0;
+        int calculateTotalTime() const;
 
         /**
          * Destructor for the event. All subclasses must override this method
@@ -0,0 +1,266 @@
+/**
+ * This file is the implementation of the AirportNetwork.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "AirportNetwork.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include "FileRequestSource.h"
+
+/**
+ * Collects the planes taking off on a route.
+ * @param event : The takeoff or landing event being handled.
+ */
+void AirportNetwork::Airport::onAction(const ActionEvent& event) {
+    if (event.getPlane().isTakeoff() && !routes.empty()) {
+        Plane plane = event.getPlane();
+        departures.push_back(Plane(plane.getAtcId(), plane.getCallSign(), plane.getFlightNumber(), plane.getSize(),
+            plane.getRequestType(), event.getTime()));
+    }
+}
+
+/**
+ * Reads the network from a configuration file.
+ * @param configFile : The configuration file (see the format above).
+ */
+AirportNetwork::AirportNetwork(const std::string& configFile) {
+
+    std::ifstream config(configFile);
+    if (!config) {
+        throw std::runtime_error("Cannot open " + configFile);
+    }
+
+    //The input files are relative to the directory of the configuration file:
+    size_t slash = configFile.find_last_of("/\\");
+    std::string directory = slash == std::string::npos ? "" : configFile.substr(0, slash + 1);
+
+    std::string line; //The line read from the configuration file
+    lookahead = std::numeric_limits<int>::max();
+    while (std::getline(config, line)) {
+
+        std::istringstream tokens(line);
+        std::string kind;
+        if (!(tokens >> kind) || kind[0] == '#') {
+            continue;
+        }
+
+        if (kind == "airport") {
+            Airport *airport = new Airport;
+            std::string inputFile;
+            if (!(tokens >> airport->name >> airport->numRunways >> inputFile) || airport->numRunways <= 0) {
+                delete airport;
+                throw std::invalid_argument("Invalid airport: " + line);
+            }
+            if (inputFile[0] != '/') {
+                inputFile = directory + inputFile;
+            }
+            airport->simulation = new Simulation(airport->numRunways);
+            airport->simulation->setObserver(airport);
+            airport->source = new NetworkRequestSource(new FileRequestSource(inputFile), FIRST_ARRIVAL_ID);
+            airport->flightsSent = 0;
+            airport->flightsReceived = 0;
+            airports.push_back(airport);
+        } else if (kind == "route") {
+            std::string from;
+            std::string to;
+            Route route;
+            if (!(tokens >> from >> to >> route.flightTime) || route.flightTime <= 0) {
+                throw std::invalid_argument("Invalid route (the flight time must be positive): " + line);
+            }
+            route.from = findAirport(from);
+            route.to = findAirport(to);
+            airports[route.from]->routes.push_back(routes.size());
+            routes.push_back(route);
+            lookahead = std::min(lookahead, route.flightTime);
+        } else {
+            throw std::invalid_argument("Unknown entry: " + line);
+        }
+
+    }
+
+    nextArrivalId = FIRST_ARRIVAL_ID;
+    windowEnd = 0;
+    windows = 0;
+    done = false;
+    arrived = 0;
+    generation = 0;
+
+}
+
+/**
+ * Destroys every airport, its simulation and its source.
+ */
+AirportNetwork::~AirportNetwork() {
+    for (size_t i = 0; i < airports.size(); i++) {
+        delete airports[i]->simulation;
+        delete airports[i]->source;
+        delete airports[i];
+    }
+}
+
+/**
+ * Finds an airport by its name.
+ * @param name : The name of the airport.
+ * @return The index of the airport.
+ */
+int AirportNetwork::findAirport(const std::string& name) const {
+    for (size_t i = 0; i < airports.size(); i++) {
+        if (airports[i]->name == name) {
+            return i;
+        }
+    }
+    throw std::invalid_argument("Unknown airport: " + name);
+}
+
+/**
+ * Simulates the whole network, one thread per airport. The first error raised by an airport stops every airport
+ * and is thrown here.
+ */
+void AirportNetwork::run() {
+
+    //The first window starts at the first request of the network:
+    done = airports.empty();
+    windowEnd = std::numeric_limits<int>::min();
+    exchange();
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < airports.size(); i++) {
+        threads.push_back(std::thread(&AirportNetwork::runAirport, this, airports[i]));
+    }
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+}
+
+/**
+ * Simulates the windows of one airport until the whole network is done. Runs on the thread of the airport.
+ * @param airport : The airport.
+ */
+void AirportNetwork::runAirport(Airport *airport) {
+
+    try {
+
+        std::unique_lock<std::mutex> lock(barrierMutex);
+
+        while (!done) {
+
+            //Simulates the window without holding the lock, every arrival up to its end having been delivered:
+            int end = windowEnd;
+            lock.unlock();
+            airport->source->setHorizon(end);
+            airport->simulation->resumeInput(*airport->source);
+            airport->simulation->runUntil(*airport->source, end);
+            lock.lock();
+
+            //The last airport to finish exchanges the flights and starts the next window, the others wait for it:
+            if (++arrived == airports.size()) {
+                arrived = 0;
+                exchange();
+                generation++;
+                barrierReleased.notify_all();
+            } else {
+                unsigned long current = generation;
+                barrierReleased.wait(lock, [this, current]() { return generation != current || done; });
+            }
+
+        }
+
+    } catch (...) {
+
+        //Keeps the first error for run() and stops the whole network, waking up the airports waiting for this one:
+        std::lock_guard<std::mutex> guard(barrierMutex);
+        if (!error) {
+            error = std::current_exception();
+        }
+        done = true;
+        barrierReleased.notify_all();
+
+    }
+
+}
+
+/**
+ * Delivers the planes that took off during the window to their destinations, then moves to the next window (or
+ * ends the simulation if no airport has events left). Called by the last airport finishing the window.
+ */
+void AirportNetwork::exchange() {
+
+    //Every plane that took off lands after the window, since no flight is shorter than the lookahead:
+    for (size_t i = 0; i < airports.size(); i++) {
+        Airport *airport = airports[i];
+        for (size_t j = 0; j < airport->departures.size(); j++) {
+            const Plane& plane = airport->departures[j];
+            int numRoutes = (int) airport->routes.size(); //The number of routes leaving from this airport
+            int index = (plane.getFlightNumber() % numRoutes + numRoutes) % numRoutes; //Never negative
+            const Route& route = routes[airport->routes[index]];
+            airports[route.to]->source->deliver(Plane(nextArrivalId++, plane.getCallSign(), plane.getFlightNumber(),
+                plane.getSize(), "landing", plane.getRequestTime() + route.flightTime));
+            airport->flightsSent++;
+            airports[route.to]->flightsReceived++;
+        }
+        airport->departures.clear();
+    }
+
+    //Skips the minutes where nothing happens anywhere:
+    int start = nextTime();
+    if (start == std::numeric_limits<int>::max()) {
+        done = true;
+        return;
+    }
+    if (windowEnd != std::numeric_limits<int>::min()) {
+        start = std::max(start, windowEnd + 1);
+    }
+
+    //Without any route, the airports never wait for each other:
+    long long end = lookahead == std::numeric_limits<int>::max() ? lookahead : (long long) start + lookahead - 1;
+    windowEnd = (int) std::min<long long>(end, std::numeric_limits<int>::max() - 1);
+    windows++;
+
+}
+
+/**
+ * Finds the time of the next event of the whole network.
+ * @return The earliest event or request of every airport, or INT_MAX if there are none left.
+ */
+int AirportNetwork::nextTime() const {
+    int time = std::numeric_limits<int>::max();
+    for (size_t i = 0; i < airports.size(); i++) {
+        time = std::min(time, airports[i]->simulation->getNextEventTime());
+        time = std::min(time, airports[i]->source->getNextTime());
+    }
+    return time;
+}
+
+/**
+ * Prints the results of every airport and the total wasted time of the network onto the console.
+ */
+void AirportNetwork::printSummary() const {
+
+    int total = 0; //The total wasted time of the network
+
+    for (size_t i = 0; i < airports.size(); i++) {
+        Airport *airport = airports[i];
+        int wasted = airport->simulation->getTotalWastedMinutes();
+        printf("Airport %s: %d runways, %d minutes wasted, %d planes handled, %d flights sent, %d flights received\n",
+            airport->name.c_str(), airport->numRunways, wasted, airport->simulation->getResult().planesHandled,
+            airport->flightsSent, airport->flightsReceived);
+        total += wasted;
+    }
+
+    printf("The number of windows simulated was %d\n", windows);
+    printf("The total amount of time wasted in the network was %d minutes\n", total);
+
+}
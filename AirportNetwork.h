@@ -0,0 +1,137 @@
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "NetworkRequestSource.h"
+#include "Simulation.h"
+
+constexpr auto FIRST_ARRIVAL_ID = 1000000000; //The ATC ID of the first plane flying from one airport to another
+
+/**
+ * Simulates a network of airports, where a takeoff at one airport becomes a landing request at another one after the
+ * flight time of the route. Each airport is a whole Simulation with its own EventPriorityQueue, WaitList and Runways,
+ * running on its own thread.
+ *
+ * The airports synchronize conservatively with lookahead windows: no flight is shorter than the lookahead (the shortest
+ * flight time of every route), so a plane taking off within a window of that length can only land after the window.
+ * Every airport simulates the window on its own, then all of them wait for each other while the flights that took off
+ * are delivered to their destinations, and the next window starts at the next event of the network.
+ *
+ * The network is read from a configuration file with one entry per line (the lines starting with # are ignored):
+ *
+ *  airport [name] [runways] [input_file]
+ *  route [from] [to] [flight_time]
+ *
+ * The input files are relative to the configuration file, and sorted by request time. A takeoff at an airport with
+ * several routes takes the route given by its flight number (modulo the number of routes, in file order, counting back
+ * from the last route for a negative flight number); the takeoffs at an airport without any route leave the network.
+ * The flying planes get ATC IDs from FIRST_ARRIVAL_ID, in the order of the airports then of their takeoffs, so the
+ * results never depend on the threads. The requests of an input file get ATC IDs from 1 and must stay below
+ * FIRST_ARRIVAL_ID: a file with more requests than that is rejected.
+ *
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class AirportNetwork {
+
+    private:
+
+        /**
+         * One airport of the network. It observes its own simulation to collect the planes taking off.
+         */
+        class Airport : public SimulationObserver {
+
+            public:
+
+                std::string name; //The name of the airport
+                int numRunways; //The number of runways of the airport
+                Simulation *simulation; //The simulation of the airport
+                NetworkRequestSource *source; //The requests of the airport, with the flights landing there
+                std::vector<int> routes; //The indexes of the routes leaving from this airport
+                std::vector<Plane> departures; //The planes that took off during the current window, with the takeoff time
+                int flightsSent; //The number of planes that flew to another airport
+                int flightsReceived; //The number of planes that flew in from another airport
+
+                /**
+                 * Collects the planes taking off on a route.
+                 * @param event : The takeoff or landing event being handled.
+                 */
+                void onAction(const ActionEvent& event) override;
+
+        };
+
+        /**
+         * A route between two airports.
+         */
+        struct Route {
+            int from; //The index of the departure airport
+            int to; //The index of the arrival airport
+            int flightTime; //The flight time in minutes
+        };
+
+        std::vector<Airport *> airports; //The airports, in the order of the configuration file
+        std::vector<Route> routes; //The routes, in the order of the configuration file
+        int lookahead; //The shortest flight time, which is the length of a window.
+        int nextArrivalId; //The ATC ID of the next plane flying from one airport to another.
+        int windowEnd; //The last time simulated by the current window.
+        int windows; //The number of windows simulated.
+        bool done; //Whether the whole network has been simulated.
+        std::mutex barrierMutex; //Guards the window shared by the airport threads.
+        std::condition_variable barrierReleased; //Notified every time a new window starts.
+        size_t arrived; //The number of airports that finished the current window.
+        unsigned long generation; //The number of the current window, to tell a new window from a spurious wake up.
+        std::exception_ptr error; //The first error raised by an airport thread (if any), which stops the whole network.
+
+        /**
+         * Finds an airport by its name.
+         * @param name : The name of the airport.
+         * @return The index of the airport.
+         */
+        int findAirport(const std::string& name) const;
+
+        /**
+         * Simulates the windows of one airport until the whole network is done. Runs on the thread of the airport.
+         * @param airport : The airport.
+         */
+        void runAirport(Airport *airport);
+
+        /**
+         * Delivers the planes that took off during the window to their destinations, then moves to the next window (or
+         * ends the simulation if no airport has events left). Called by the last airport finishing the window.
+         */
+        void exchange();
+
+        /**
+         * Finds the time of the next event of the whole network.
+         * @return The earliest event or request of every airport, or INT_MAX if there are none left.
+         */
+        int nextTime() const;
+
+    public:
+
+        /**
+         * Reads the network from a configuration file.
+         * @param configFile : The configuration file (see the format above).
+         */
+        AirportNetwork(const std::string& configFile);
+
+        /**
+         * Simulates the whole network, one thread per airport. The first error raised by an airport stops every airport
+         * and is thrown here.
+         */
+        void run();
+
+        /**
+         * Prints the results of every airport and the total wasted time of the network onto the console.
+         */
+        void printSummary() const;
+
+        /**
+         * Destroys every airport, its simulation and its source.
+         */
+        ~AirportNetwork();
+
+};
@@ -0,0 +1,151 @@
+/**
+ * This file is the implementation of the BatchExecutor.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "BatchExecutor.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+
+/**
+ * Reads the scenarios of a manifest.
+ * @param manifestFile : The manifest, one scenario per line.
+ * @param numWorkers : The number of worker threads (0 uses every core).
+ */
+BatchExecutor::BatchExecutor(const std::string& manifestFile, unsigned numWorkers) {
+
+    std::ifstream manifest(manifestFile);
+    if (!manifest) {
+        throw std::runtime_error("Cannot open " + manifestFile);
+    }
+
+    std::string line; //The line read from the manifest
+    while (std::getline(manifest, line)) {
+        size_t first = line.find_first_not_of(" \t\r");
+        if (first != std::string::npos && line[first] != '#') {
+            scenarios.push_back(line);
+        }
+    }
+
+    this->numWorkers = (numWorkers == 0) ? std::max(1u, std::thread::hardware_concurrency()) : numWorkers;
+    deques = new WorkerDeque[this->numWorkers];
+    slots = new WorkerSlot[this->numWorkers];
+
+}
+
+/**
+ * Destroys the deques and the slots of the workers.
+ */
+BatchExecutor::~BatchExecutor() {
+    delete[] deques;
+    delete[] slots;
+}
+
+/**
+ * Runs every scenario, then writes their answers in manifest order, one per line.
+ * @param outputFile : The file receiving the answers.
+ */
+void BatchExecutor::run(const std::string& outputFile) {
+
+    std::ofstream output(outputFile);
+    if (!output) {
+        throw std::runtime_error("Cannot write " + outputFile);
+    }
+
+    //Deals the scenarios round-robin, so every worker starts with a share of the whole manifest:
+    for (unsigned i = 0; i < numWorkers; i++) {
+        deques[i].scenarios.clear();
+        slots[i].answers.clear();
+        slots[i].stolen = 0;
+        slots[i].busySeconds = 0;
+    }
+    for (size_t i = 0; i < scenarios.size(); i++) {
+        deques[i % numWorkers].scenarios.push_back(i);
+    }
+
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < numWorkers; i++) {
+        threads.push_back(std::thread(&BatchExecutor::work, this, i));
+    }
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+
+    //Puts the answers of every worker back in manifest order:
+    std::vector<std::string> answers(scenarios.size());
+    for (unsigned i = 0; i < numWorkers; i++) {
+        for (size_t j = 0; j < slots[i].answers.size(); j++) {
+            answers[slots[i].answers[j].first].swap(slots[i].answers[j].second);
+        }
+    }
+    for (size_t i = 0; i < answers.size(); i++) {
+        output << answers[i] << '\n';
+    }
+
+}
+
+/**
+ * Body of each worker thread: runs scenarios until every deque is empty.
+ * @param worker : The index of the worker.
+ */
+void BatchExecutor::work(unsigned worker) {
+
+    WorkerSlot& slot = slots[worker];
+    size_t scenario; //The index of the scenario being run
+
+    while (take(worker, scenario)) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        slot.answers.push_back(std::make_pair(scenario, runner.answer(scenarios[scenario])));
+        slot.busySeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+}
+
+/**
+ * Takes the next scenario of a worker: from the back of its own deque, otherwise from the front of another one.
+ * @param worker : The index of the worker.
+ * @param scenario : Receives the index of the scenario.
+ * @return true if a scenario was taken, false if every deque is empty.
+ */
+bool BatchExecutor::take(unsigned worker, size_t& scenario) {
+
+    {
+        std::lock_guard<std::mutex> guard(deques[worker].lock);
+        if (!deques[worker].scenarios.empty()) {
+            scenario = deques[worker].scenarios.back();
+            deques[worker].scenarios.pop_back();
+            return true;
+        }
+    }
+
+    //No scenario is ever added, so once every other deque is found empty, the batch is over for this worker:
+    for (unsigned i = 1; i < numWorkers; i++) {
+        WorkerDeque& victim = deques[(worker + i) % numWorkers];
+        std::lock_guard<std::mutex> guard(victim.lock);
+        if (!victim.scenarios.empty()) {
+            scenario = victim.scenarios.front();
+            victim.scenarios.pop_front();
+            slots[worker].stolen++;
+            return true;
+        }
+    }
+
+    return false;
+
+}
+
+/**
+ * Prints how many scenarios each worker ran and stole, and how long it was busy, onto the console.
+ */
+void BatchExecutor::printSummary() const {
+    for (unsigned i = 0; i < numWorkers; i++) {
+        printf("Worker %u: %zu scenarios (%d stolen), busy for %.3f seconds\n", i + 1, slots[i].answers.size(),
+            slots[i].stolen, slots[i].busySeconds);
+    }
+    printf("The number of scenarios run was %zu\n", scenarios.size());
+}
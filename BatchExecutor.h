@@ -0,0 +1,91 @@
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ScenarioRunner.h"
+
+/**
+ * Runs a batch of scenarios listed in a manifest, one per line in the ScenarioRunner format (the empty lines and the
+ * lines starting with # are ignored), on a pool of worker threads, then writes their answers in manifest order.
+ *
+ * The scenarios can take very different times, so they are not simply split between the workers: each worker has its
+ * own deque of scenarios, dealt round-robin at the start. A worker takes the scenarios from the back of its own deque,
+ * and once it is empty, steals from the front of the deque of another worker, so no worker sits idle while others
+ * still have scenarios waiting. Each worker keeps its answers in its own slot, padded so that two workers never write
+ * to the same cache line.
+ *
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class BatchExecutor {
+
+    private:
+
+        /**
+         * The scenarios waiting for a worker, by index in the manifest.
+         */
+        struct WorkerDeque {
+            std::mutex lock; //Protects the scenarios, taken by the worker itself or stolen by the others
+            std::deque<size_t> scenarios; //The scenarios waiting
+            char padding[64]; //Keeps the deques of two workers on different cache lines
+        };
+
+        /**
+         * The answers and counters of a worker, only written by that worker.
+         */
+        struct WorkerSlot {
+            std::vector<std::pair<size_t, std::string> > answers; //The answers, with the index of their scenario
+            int stolen; //The number of scenarios stolen from the other workers
+            double busySeconds; //The time spent running scenarios
+            char padding[64]; //Keeps the slots of two workers on different cache lines
+        };
+
+        std::vector<std::string> scenarios; //The scenarios of the manifest, in order.
+        unsigned numWorkers; //The number of worker threads.
+        ScenarioRunner runner; //Runs the scenarios, keeping the traces in memory.
+        WorkerDeque *deques; //The deque of each worker.
+        WorkerSlot *slots; //The slot of each worker.
+
+        /**
+         * Takes the next scenario of a worker: from the back of its own deque, otherwise from the front of another one.
+         * @param worker : The index of the worker.
+         * @param scenario : Receives the index of the scenario.
+         * @return true if a scenario was taken, false if every deque is empty.
+         */
+        bool take(unsigned worker, size_t& scenario);
+
+        /**
+         * Body of each worker thread: runs scenarios until every deque is empty.
+         * @param worker : The index of the worker.
+         */
+        void work(unsigned worker);
+
+    public:
+
+        /**
+         * Reads the scenarios of a manifest.
+         * @param manifestFile : The manifest, one scenario per line.
+         * @param numWorkers : The number of worker threads (0 uses every core).
+         */
+        BatchExecutor(const std::string& manifestFile, unsigned numWorkers = 0);
+
+        /**
+         * Runs every scenario, then writes their answers in manifest order, one per line.
+         * @param outputFile : The file receiving the answers.
+         */
+        void run(const std::string& outputFile);
+
+        /**
+         * Prints how many scenarios each worker ran and stole, and how long it was busy, onto the console.
+         */
+        void printSummary() const;
+
+        /**
+         * Destroys the deques and the slots of the workers.
+         */
+        ~BatchExecutor();
+
+};
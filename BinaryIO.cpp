@@ -0,0 +1,121 @@
+/**
+ * This file is the implementation of the BinaryIO.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "BinaryIO.h"
+
+#include <stdexcept>
+
+/**
+ * Writes the lowest bytes of the value, least significant first.
+ * @param out : The output stream.
+ * @param value : The value to be written.
+ * @param numBytes : The number of bytes to be written.
+ */
+static void writeBytes(std::ostream& out, uint64_t value, int numBytes) {
+    char bytes[8];
+    for (int i = 0; i < numBytes; i++) {
+        bytes[i] = (char) (value >> (8 * i));
+    }
+    out.write(bytes, numBytes);
+}
+
+/**
+ * Reads a value stored with its least significant byte first.
+ * @param in : The input stream.
+ * @param numBytes : The number of bytes to be read.
+ * @return The value read.
+ */
+static uint64_t readBytes(std::istream& in, int numBytes) {
+    unsigned char bytes[8];
+    if (!in.read((char *) bytes, numBytes)) {
+        throw std::runtime_error("Unexpected end of binary data");
+    }
+    uint64_t value = 0;
+    for (int i = numBytes - 1; i >= 0; i--) {
+        value = (value << 8) | bytes[i];
+    }
+    return value;
+}
+
+/**
+ * Writes a 32-bit integer.
+ * @param out : The output stream.
+ * @param value : The value to be written.
+ */
+void BinaryIO::writeInt(std::ostream& out, int32_t value) {
+    writeBytes(out, (uint32_t) value, 4);
+}
+
+/**
+ * Writes a 64-bit integer.
+ * @param out : The output stream.
+ * @param value : The value to be written.
+ */
+void BinaryIO::writeLong(std::ostream& out, int64_t value) {
+    writeBytes(out, (uint64_t) value, 8);
+}
+
+/**
+ * Writes a boolean as a single byte.
+ * @param out : The output stream.
+ * @param value : The value to be written.
+ */
+void BinaryIO::writeBool(std::ostream& out, bool value) {
+    writeBytes(out, value ? 1 : 0, 1);
+}
+
+/**
+ * Writes a string as its length followed by its characters.
+ * @param out : The output stream.
+ * @param value : The value to be written.
+ */
+void BinaryIO::writeString(std::ostream& out, const std::string& value) {
+    writeInt(out, (int32_t) value.size());
+    out.write(value.data(), value.size());
+}
+
+/**
+ * Reads a 32-bit integer.
+ * @param in : The input stream.
+ * @return The value read.
+ */
+int32_t BinaryIO::readInt(std::istream& in) {
+    return (int32_t) (uint32_t) readBytes(in, 4);
+}
+
+/**
+ * Reads a 64-bit integer.
+ * @param in : The input stream.
+ * @return The value read.
+ */
+int64_t BinaryIO::readLong(std::istream& in) {
+    return (int64_t) readBytes(in, 8);
+}
+
+/**
+ * Reads a boolean stored as a single byte.
+ * @param in : The input stream.
+ * @return The value read.
+ */
+bool BinaryIO::readBool(std::istream& in) {
+    return readBytes(in, 1) != 0;
+}
+
+/**
+ * Reads a string stored as its length followed by its characters.
+ * @param in : The input stream.
+ * @return The value read.
+ */
+std::string BinaryIO::readString(std::istream& in) {
+    int32_t length = readInt(in);
+    if (length < 0) {
+        throw std::runtime_error("Invalid string length in binary data");
+    }
+    std::string value(length, '\0');
+    if (length > 0 && !in.read(&value[0], length)) {
+        throw std::runtime_error("Unexpected end of binary data");
+    }
+    return value;
+}
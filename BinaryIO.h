@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+/**
+ * Reads and writes the basic values of the binary files (such as the checkpoints). Every integer is stored in little
+ * endian order whatever the machine is, so the files can be moved from one machine to another.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class BinaryIO {
+
+    public:
+
+        /**
+         * Writes a 32-bit integer.
+         * @param out : The output stream.
+         * @param value : The value to be written.
+         */
+        static void writeInt(std::ostream& out, int32_t value);
+
+        /**
+         * Writes a 64-bit integer.
+         * @param out : The output stream.
+         * @param value : The value to be written.
+         */
+        static void writeLong(std::ostream& out, int64_t value);
+
+        /**
+         * Writes a boolean as a single byte.
+         * @param out : The output stream.
+         * @param value : The value to be written.
+         */
+        static void writeBool(std::ostream& out, bool value);
+
+        /**
+         * Writes a string as its length followed by its characters.
+         * @param out : The output stream.
+         * @param value : The value to be written.
+         */
+        static void writeString(std::ostream& out, const std::string& value);
+
+        /**
+         * Reads a 32-bit integer.
+         * @param in : The input stream.
+         * @return The value read.
+         */
+        static int32_t readInt(std::istream& in);
+
+        /**
+         * Reads a 64-bit integer.
+         * @param in : The input stream.
+         * @return The value read.
+         */
+        static int64_t readLong(std::istream& in);
+
+        /**
+         * Reads a boolean stored as a single byte.
+         * @param in : The input stream.
+         * @return The value read.
+         */
+        static bool readBool(std::istream& in);
+
+        /**
+         * Reads a string stored as its length followed by its characters.
+         * @param in : The input stream.
+         * @return The value read.
+         */
+        static std::string readString(std::istream& in);
+
+};
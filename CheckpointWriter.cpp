@@ -0,0 +1,157 @@
+/**
+ * This file is the implementation of the CheckpointWriter.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "CheckpointWriter.h"
+
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+
+#include "BinaryIO.h"
+#include "Simulation.h"
+
+constexpr auto CHECKPOINT_MAGIC = 0x4B435441; //"ATCK" in little endian, marks the checkpoint files
+constexpr auto CHECKPOINT_VERSION = 2; //The version of the checkpoint format
+
+/**
+ * Starts the writer thread.
+ * @param fileName : The name of the checkpoint file.
+ */
+CheckpointWriter::CheckpointWriter(const std::string& fileName) : fileName(fileName) {
+    pending = nullptr;
+    pendingOffset = 0;
+    pendingNextId = 0;
+    stopping = false;
+    writer = std::thread(&CheckpointWriter::work, this);
+}
+
+/**
+ * Hands a checkpoint to the writer thread. Any pending checkpoint that has not been written yet is dropped.
+ * @param snapshot : A heap-allocated copy of the simulation, owned by the writer from now on.
+ * @param offset : The byte offset of the next line of the input file (-1 at the end of the file).
+ * @param nextId : The ATC ID of the request on that line.
+ */
+void CheckpointWriter::submit(Simulation *snapshot, std::streamoff offset, int nextId) {
+
+    Simulation *dropped; //The older checkpoint replaced by this one
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        dropped = pending;
+        pending = snapshot;
+        pendingOffset = offset;
+        pendingNextId = nextId;
+    }
+    ready.notify_one();
+
+    //Deletes the dropped copy outside the lock:
+    delete dropped;
+
+}
+
+/**
+ * Body of the writer thread: writes the pending checkpoints until the writer is destroyed.
+ */
+void CheckpointWriter::work() {
+
+    while (true) {
+
+        Simulation *snapshot; //The checkpoint to be written
+        std::streamoff offset;
+        int nextId;
+
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            ready.wait(guard, [this]() { return pending != nullptr || stopping; });
+            if (pending == nullptr) {
+                return;
+            }
+            snapshot = pending;
+            offset = pendingOffset;
+            nextId = pendingNextId;
+            pending = nullptr;
+        }
+
+        //A failed checkpoint must not stop the simulation, the previous checkpoint is kept instead:
+        try {
+            write(*snapshot, offset, nextId);
+        } catch (const std::exception& error) {
+            std::cerr << "Cannot write checkpoint " << fileName << ": " << error.what() << std::endl;
+        }
+        delete snapshot;
+
+    }
+
+}
+
+/**
+ * Writes one checkpoint into the temporary file, then renames it over the checkpoint file.
+ * @param snapshot : The copy of the simulation to be written.
+ * @param offset : The byte offset of the next line of the input file (-1 at the end of the file).
+ * @param nextId : The ATC ID of the request on that line.
+ */
+void CheckpointWriter::write(const Simulation& snapshot, std::streamoff offset, int nextId) {
+
+    std::string tempName = fileName + ".tmp"; //The file written before being renamed
+
+    {
+        std::ofstream out(tempName, std::ios::binary | std::ios::trunc);
+        BinaryIO::writeInt(out, CHECKPOINT_MAGIC);
+        BinaryIO::writeInt(out, CHECKPOINT_VERSION);
+        BinaryIO::writeLong(out, offset);
+        BinaryIO::writeInt(out, nextId);
+        snapshot.writeState(out);
+        out.flush();
+        if (!out) {
+            throw std::runtime_error("write failed");
+        }
+    }
+
+#ifdef _WIN32
+    //Windows does not rename over an existing file:
+    std::remove(fileName.c_str());
+#endif
+    if (std::rename(tempName.c_str(), fileName.c_str()) != 0) {
+        throw std::runtime_error("rename failed");
+    }
+
+}
+
+/**
+ * Restores a simulation from the given checkpoint file.
+ * @param fileName : The name of the checkpoint file.
+ * @param simulation : A new simulation with the same number of runways, receiving the state of the checkpoint.
+ * @param offset : Receives the byte offset of the next line of the input file (-1 at the end of the file).
+ * @param nextId : Receives the ATC ID of the request on that line.
+ * @return true if the checkpoint was restored, false if there is no checkpoint file.
+ */
+bool CheckpointWriter::restore(const std::string& fileName, Simulation& simulation, std::streamoff& offset, int& nextId) {
+
+    std::ifstream in(fileName, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    if (BinaryIO::readInt(in) != CHECKPOINT_MAGIC || BinaryIO::readInt(in) != CHECKPOINT_VERSION) {
+        throw std::runtime_error(fileName + " is not a checkpoint file");
+    }
+    offset = BinaryIO::readLong(in);
+    nextId = BinaryIO::readInt(in);
+    simulation.readState(in);
+    return true;
+
+}
+
+/**
+ * Writes the last pending checkpoint (if any), then stops the writer thread.
+ */
+CheckpointWriter::~CheckpointWriter() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    ready.notify_one();
+    writer.join();
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+class Simulation;
+
+/**
+ * Writes the checkpoints of a running simulation on a background thread, so that the simulation only pays for taking a
+ * copy of its state (see Simulation::Simulation(const Simulation&)). A checkpoint holds the whole simulation state (see
+ * Simulation::writeState(std::ostream&)) along with the position of the next line of the input file and the ATC ID of
+ * the request on that line.
+ *
+ * Each checkpoint is first written to "[fileName].tmp", then renamed over the previous one, so the checkpoint file is
+ * always complete even if the program is killed during a write. If the simulation submits a new checkpoint before the
+ * previous one is written, only the latest one is written.
+ *
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class CheckpointWriter {
+
+    private:
+
+        std::string fileName; //The name of the checkpoint file
+        std::mutex lock; //Protects the pending checkpoint
+        std::condition_variable ready; //Signals a pending checkpoint or the end of the simulation
+        Simulation *pending; //The copy of the simulation waiting to be written (nullptr if none)
+        std::streamoff pendingOffset; //The input file offset of the pending checkpoint
+        int pendingNextId; //The next ATC ID of the pending checkpoint
+        bool stopping; //Whether the writer thread must stop once the pending checkpoint is written
+        std::thread writer; //The thread writing the checkpoints
+
+        /**
+         * Body of the writer thread: writes the pending checkpoints until the writer is destroyed.
+         */
+        void work();
+
+        /**
+         * Writes one checkpoint into the temporary file, then renames it over the checkpoint file.
+         * @param snapshot : The copy of the simulation to be written.
+         * @param offset : The byte offset of the next line of the input file (-1 at the end of the file).
+         * @param nextId : The ATC ID of the request on that line.
+         */
+        void write(const Simulation& snapshot, std::streamoff offset, int nextId);
+
+    public:
+
+        /**
+         * Starts the writer thread.
+         * @param fileName : The name of the checkpoint file.
+         */
+        CheckpointWriter(const std::string& fileName);
+
+        /**
+         * Hands a checkpoint to the writer thread. Any pending checkpoint that has not been written yet is dropped.
+         * @param snapshot : A heap-allocated copy of the simulation, owned by the writer from now on.
+         * @param offset : The byte offset of the next line of the input file (-1 at the end of the file).
+         * @param nextId : The ATC ID of the request on that line.
+         */
+        void submit(Simulation *snapshot, std::streamoff offset, int nextId);
+
+        /**
+         * Restores a simulation from the given checkpoint file.
+         * @param fileName : The name of the checkpoint file.
+         * @param simulation : A new simulation with the same number of runways, receiving the state of the checkpoint.
+         * @param offset : Receives the byte offset of the next line of the input file (-1 at the end of the file).
+         * @param nextId : Receives the ATC ID of the request on that line.
+         * @return true if the checkpoint was restored, false if there is no checkpoint file.
+         */
+        static bool restore(const std::string& fileName, Simulation& simulation, std::streamoff& offset, int& nextId);
+
+        /**
+         * Writes the last pending checkpoint (if any), then stops the writer thread.
+         */
+        ~CheckpointWriter();
+
+};
@@ -29,7 +29,7 @@ CompleteEvent::CompleteEvent(const CompleteEvent &completeEvent) : Event(complet
  * Prints the event information onto the console. The following information is displayed for this event:
  * TIME: [time] -> [plane] has cleared runway [runwayID].
  */
-void CompleteEvent::processEvent() {
+void CompleteEvent::processEvent() const {
     std::cout << "TIME: " << this->startTime << " -> " << this->plane << " has cleared runway " << this->runwayID << std::endl;
 }
 
@@ -34,7 +34,7 @@ class CompleteEvent : public Event {
          * Prints the event information onto the console. The following information is displayed for this event:
          * TIME: [time] -> [plane] has cleared runway [runwayID].
          */
-        void processEvent() override;
+        void processEvent() const override;
 
         /**
          * Returns the runway ID assigned to this event.
@@ -0,0 +1,87 @@
+/**
+ * This file is the implementation of the CoreBenchmark.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "CoreBenchmark.h"
+
+#include <chrono>
+#include <cstdio>
+
+#include "Simulation.h"
+#include "SimulationCore.h"
+#include "TraceLoader.h"
+
+typedef std::chrono::steady_clock Clock;
+
+/**
+ * Loads the trace of the benchmark.
+ * @param fileName : The input file.
+ * @param numRunways : The number of runways of every engine.
+ */
+CoreBenchmark::CoreBenchmark(const std::string& fileName, int numRunways) : trace(TraceLoader::load(fileName)) {
+    this->numRunways = numRunways;
+}
+
+/**
+ * Prints the result and the time of one engine onto the console.
+ * @param name : The name of the engine.
+ * @param wasted : The total wasted time computed by the engine.
+ * @param seconds : The time of its fastest run.
+ */
+void CoreBenchmark::report(const char *name, int wasted, double seconds) const {
+    printf("%-60s %10d minutes wasted %10.2f ms\n", name, wasted, seconds * 1000);
+}
+
+/**
+ * Runs one instantiation of the SimulationCore BENCH_REPEATS times and reports its fastest run.
+ * @param name : The name of the instantiation.
+ */
+template <typename Core>
+void CoreBenchmark::time(const char *name) const {
+    double best = 0; //The time of the fastest run
+    int wasted = 0; //The total wasted time of the last run
+    for (int i = 0; i < BENCH_REPEATS; i++) {
+        Core core(numRunways);
+        Clock::time_point start = Clock::now();
+        wasted = core.run(trace.data(), trace.data() + trace.size()).totalWastedMinutes;
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        if (i == 0 || seconds < best) {
+            best = seconds;
+        }
+    }
+    report(name, wasted, best);
+}
+
+/**
+ * Runs every engine and prints their total wasted time and their fastest run onto the console.
+ */
+void CoreBenchmark::run() const {
+
+    printf("%d requests, %d runways, fastest of %d runs\n", (int) trace.size(), numRunways, BENCH_REPEATS);
+
+    //The Simulation class, with its heap-allocated virtual events:
+    double best = 0;
+    int wasted = 0;
+    for (int i = 0; i < BENCH_REPEATS; i++) {
+        Simulation simulation(numRunways);
+        simulation.setObserver(nullptr);
+        Clock::time_point start = Clock::now();
+        wasted = simulation.run(trace.data(), trace.data() + trace.size()).totalWastedMinutes;
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        if (i == 0 || seconds < best) {
+            best = seconds;
+        }
+    }
+    report("Simulation", wasted, best);
+
+    //The instantiations of the core, the first one making the same choices as the Simulation class:
+    time<DefaultSimulationCore>("SimulationCore<SortedList, LandingFirst, LowestFree>");
+    time<SimulationCore<BinaryHeapQueue, LandingFirst, LowestFreeRunway> >(
+        "SimulationCore<BinaryHeap, LandingFirst, LowestFree>");
+    time<SimulationCore<BinaryHeapQueue, LandingFirst, RotatingRunway> >(
+        "SimulationCore<BinaryHeap, LandingFirst, Rotating>");
+    time<SimulationCore<BinaryHeapQueue, FirstComeFirstServed, LowestFreeRunway> >(
+        "SimulationCore<BinaryHeap, FirstComeFirstServed, LowestFree>");
+
+}
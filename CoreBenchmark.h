@@ -0,0 +1,52 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Plane.h"
+
+constexpr auto BENCH_REPEATS = 3; //The number of times each engine is run by the benchmark (the fastest run is kept).
+
+/**
+ * Times the Simulation class against several instantiations of the SimulationCore on the same trace, to show what
+ * choosing the event queue, the wait policy and the runway policy at compile time gains over the virtual events. The
+ * trace is loaded once and every engine runs silently on it, so only the simulation itself is timed.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class CoreBenchmark {
+
+    private:
+
+        std::vector<Plane> trace; //The requests of the input file.
+        int numRunways; //The number of runways of every engine.
+
+        /**
+         * Prints the result and the time of one engine onto the console.
+         * @param name : The name of the engine.
+         * @param wasted : The total wasted time computed by the engine.
+         * @param seconds : The time of its fastest run.
+         */
+        void report(const char *name, int wasted, double seconds) const;
+
+        /**
+         * Runs one instantiation of the SimulationCore BENCH_REPEATS times and reports its fastest run.
+         * @param name : The name of the instantiation.
+         */
+        template <typename Core>
+        void time(const char *name) const;
+
+    public:
+
+        /**
+         * Loads the trace of the benchmark.
+         * @param fileName : The input file.
+         * @param numRunways : The number of runways of every engine.
+         */
+        CoreBenchmark(const std::string& fileName, int numRunways);
+
+        /**
+         * Runs every engine and prints their total wasted time and their fastest run onto the console.
+         */
+        void run() const;
+
+};
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <deque>
+#include <vector>
+
+/**
+ * The wait and runway policies of the SimulationCore.
+ *
+ * A wait policy is an ordering functor over two CoreTickets: it returns true if the first plane gets a runway before
+ * the second one. A runway policy is a class built from the number of runways, with acquire() returning the ID of the
+ * runway given to the next plane (0 if they are all busy) and release(int) taking a runway back.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+
+/**
+ * What the SimulationCore keeps of a plane: the fields used to order it, and the time it holds its runway (computed
+ * once when the request is read, see Plane::getServiceTime()).
+ */
+struct CoreTicket {
+    bool takeoff; //Whether the plane is taking off (otherwise it is landing).
+    int requestTime; //The time when the plane made its request.
+    int atcId; //The ATC ID of the plane.
+    int serviceTime; //The number of minutes the plane holds its runway.
+};
+
+/**
+ * The order of the WaitList: landings first, then the earlier request, then the lower ATC ID.
+ */
+struct LandingFirst {
+    bool operator()(const CoreTicket& plane1, const CoreTicket& plane2) const {
+        if (plane1.takeoff != plane2.takeoff) {
+            return plane2.takeoff;
+        }
+        if (plane1.requestTime != plane2.requestTime) {
+            return plane1.requestTime < plane2.requestTime;
+        }
+        return plane1.atcId < plane2.atcId;
+    }
+};
+
+/**
+ * First come, first served: the earlier request, then the lower ATC ID, whether the plane lands or takes off.
+ */
+struct FirstComeFirstServed {
+    bool operator()(const CoreTicket& plane1, const CoreTicket& plane2) const {
+        if (plane1.requestTime != plane2.requestTime) {
+            return plane1.requestTime < plane2.requestTime;
+        }
+        return plane1.atcId < plane2.atcId;
+    }
+};
+
+/**
+ * The policy of the Runways class: the free runway with the lowest ID. The search resumes where the previous one stopped,
+ * since every runway before it is occupied.
+ */
+class LowestFreeRunway {
+
+    private:
+
+        std::vector<bool> occupied; //Whether each runway is occupied (index 0 is unused).
+        int nextFree; //The ID where the next search for a free runway starts.
+
+    public:
+
+        /**
+         * Constructs the policy with every runway free.
+         * @param numRunways : The number of runways.
+         */
+        LowestFreeRunway(int numRunways) : occupied(numRunways + 1, false) {
+            nextFree = 1;
+        }
+
+        /**
+         * Occupies the free runway with the lowest ID.
+         * @return The runway ID, or 0 if every runway is occupied.
+         */
+        int acquire() {
+            int numRunways = occupied.size() - 1;
+            while (nextFree <= numRunways && occupied[nextFree]) {
+                nextFree++;
+            }
+            if (nextFree > numRunways) {
+                return 0;
+            }
+            occupied[nextFree] = true;
+            return nextFree;
+        }
+
+        /**
+         * Frees a runway.
+         * @param id : The runway ID.
+         */
+        void release(int id) {
+            occupied[id] = false;
+            if (id < nextFree) {
+                nextFree = id;
+            }
+        }
+
+};
+
+/**
+ * Spreads the traffic over every runway: the runway that has been free for the longest time is given first.
+ */
+class RotatingRunway {
+
+    private:
+
+        std::deque<int> free; //The free runway IDs, from the one cleared first to the one cleared last.
+
+    public:
+
+        /**
+         * Constructs the policy with every runway free, the lowest ID first.
+         * @param numRunways : The number of runways.
+         */
+        RotatingRunway(int numRunways) {
+            for (int i = 1; i <= numRunways; i++) {
+                free.push_back(i);
+            }
+        }
+
+        /**
+         * Occupies the runway that has been free for the longest time.
+         * @return The runway ID, or 0 if every runway is occupied.
+         */
+        int acquire() {
+            if (free.empty()) {
+                return 0;
+            }
+            int id = free.front();
+            free.pop_front();
+            return id;
+        }
+
+        /**
+         * Frees a runway, putting it at the back of the rotation.
+         * @param id : The runway ID.
+         */
+        void release(int id) {
+            free.push_back(id);
+        }
+
+};
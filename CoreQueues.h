@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * The queue backends of the SimulationCore. Each one is a class template over the element type and an ordering
+ * functor Before, where Before()(a, b) is true if a must come out before b, and offers the same four operations:
+ * push(const T&), top(), pop() and empty(). The functor is a template parameter, so the compiler can inline it into
+ * the queue operations instead of calling a comparison through a function pointer or a virtual call.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+
+/**
+ * A singly linked list kept in order, like the EventPriorityQueue and the WaitList: each push walks the list from the
+ * front to its spot, the front is popped in constant time. A new element goes before the elements it is equal to.
+ */
+template <typename T, typename Before>
+class SortedListQueue {
+
+    private:
+
+        /**
+         * A node of the list.
+         */
+        struct Node {
+            T value; //The element stored in this node
+            Node *next; //The next node (nullptr at the back)
+        };
+
+        Node *head; //The front of this queue.
+
+    public:
+
+        /**
+         * Constructs an empty queue.
+         */
+        SortedListQueue() {
+            head = nullptr;
+        }
+
+        /**
+         * Adds an element at its spot in this queue.
+         * @param value : The element to be added.
+         */
+        void push(const T& value) {
+            Before before;
+            Node **link = &head; //The link where the new node goes
+            while (*link != nullptr && before((*link)->value, value)) {
+                link = &(*link)->next;
+            }
+            *link = new Node{ value, *link };
+        }
+
+        /**
+         * Retrieves the element at the front of this queue, which must not be empty.
+         * @return The element at the front.
+         */
+        const T& top() const {
+            return head->value;
+        }
+
+        /**
+         * Removes the element at the front of this queue, which must not be empty.
+         */
+        void pop() {
+            Node *front = head;
+            head = front->next;
+            delete front;
+        }
+
+        /**
+         * Indicates if this queue is empty or not.
+         * @return true if this queue is empty, false otherwise.
+         */
+        bool empty() const {
+            return head == nullptr;
+        }
+
+        /**
+         * Deallocates every node left in this queue.
+         */
+        ~SortedListQueue() {
+            while (head != nullptr) {
+                pop();
+            }
+        }
+
+        SortedListQueue(const SortedListQueue&) = delete;
+        SortedListQueue& operator=(const SortedListQueue&) = delete;
+
+};
+
+/**
+ * A binary heap stored in a vector: each push and pop takes a logarithmic number of comparisons, whatever the length of
+ * the queue. Equal elements come out in no particular order, so Before must be a total order to get the same results as
+ * the SortedListQueue.
+ */
+template <typename T, typename Before>
+class BinaryHeapQueue {
+
+    private:
+
+        /**
+         * Reverses the ordering, since the standard heap algorithms keep the greatest element at the front.
+         */
+        struct After {
+            bool operator()(const T& value1, const T& value2) const {
+                return Before()(value2, value1);
+            }
+        };
+
+        std::vector<T> heap; //The elements of this queue, in heap order.
+
+    public:
+
+        /**
+         * Adds an element into this queue.
+         * @param value : The element to be added.
+         */
+        void push(const T& value) {
+            heap.push_back(value);
+            std::push_heap(heap.begin(), heap.end(), After());
+        }
+
+        /**
+         * Retrieves the element at the front of this queue, which must not be empty.
+         * @return The element at the front.
+         */
+        const T& top() const {
+            return heap.front();
+        }
+
+        /**
+         * Removes the element at the front of this queue, which must not be empty.
+         */
+        void pop() {
+            std::pop_heap(heap.begin(), heap.end(), After());
+            heap.pop_back();
+        }
+
+        /**
+         * Indicates if this queue is empty or not.
+         * @return true if this queue is empty, false otherwise.
+         */
+        bool empty() const {
+            return heap.empty();
+        }
+
+};
@@ -10,6 +10,12 @@
 #include "LandingEvent.h"
 #include "TakeoffEvent.h"
 #include "CompleteEvent.h"
+#include "BinaryIO.h"
+
+/**
+ * The type tags used to write the events in binary form.
+ */
+enum EventType { REQUEST_LANDING, REQUEST_TAKEOFF, LANDING, TAKEOFF, COMPLETE };
 
 /**
  * Base constructor for any event classes. All events subclasses must inherit this constructor.
@@ -81,3 +87,67 @@ Event *Event::clone(Event *other) {
 		throw std::runtime_error("Type cast error occurred");
 		
 }
+
+/**
+ * Writes the given event in binary form (see BinaryIO): its type, time, plane and runway ID if it has one.
+ * @param out : The binary output stream.
+ * @param event : The event to be written.
+ */
+void Event::write(std::ostream& out, Event *event) {
+
+	ActionEvent *action = dynamic_cast<ActionEvent *>(event);
+	CompleteEvent *complete = dynamic_cast<CompleteEvent *>(event);
+
+	//Writes the type tag first, based on the dynamic_cast that returns non-null:
+	if (dynamic_cast<RequestLandingEvent *>(event) != nullptr)
+		BinaryIO::writeInt(out, REQUEST_LANDING);
+	else if (dynamic_cast<RequestTakeoffEvent *>(event) != nullptr)
+		BinaryIO::writeInt(out, REQUEST_TAKEOFF);
+	else if (dynamic_cast<LandingEvent *>(event) != nullptr)
+		BinaryIO::writeInt(out, LANDING);
+	else if (dynamic_cast<TakeoffEvent *>(event) != nullptr)
+		BinaryIO::writeInt(out, TAKEOFF);
+	else if (complete != nullptr)
+		BinaryIO::writeInt(out, COMPLETE);
+	else
+		throw std::runtime_error("Type cast error occurred");
+
+	BinaryIO::writeInt(out, event->startTime);
+	event->plane.write(out);
+
+	//Only the action and complete events have a runway:
+	if (action != nullptr)
+		BinaryIO::writeInt(out, action->getRunwayID());
+	else if (complete != nullptr)
+		BinaryIO::writeInt(out, complete->getRunwayID());
+
+}
+
+/**
+ * Reads an event written by Event::write(std::ostream&, Event *).
+ * @param in : The binary input stream.
+ * @return A heap-allocated event of the same type, owned by the caller.
+ */
+Event *Event::read(std::istream& in) {
+
+	int type = BinaryIO::readInt(in);
+	int time = BinaryIO::readInt(in);
+	Plane plane = Plane::read(in);
+
+	//Creates the event of the same type, reading its runway if it has one:
+	switch (type) {
+		case REQUEST_LANDING:
+			return new RequestLandingEvent(time, plane);
+		case REQUEST_TAKEOFF:
+			return new RequestTakeoffEvent(time, plane);
+		case LANDING:
+			return new LandingEvent(time, plane, BinaryIO::readInt(in));
+		case TAKEOFF:
+			return new TakeoffEvent(time, plane, BinaryIO::readInt(in));
+		case COMPLETE:
+			return new CompleteEvent(time, plane, BinaryIO::readInt(in));
+		default:
+			throw std::runtime_error("Unknown event type in binary data");
+	}
+
+}
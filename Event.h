@@ -51,7 +51,7 @@ class Event {
         /**
          * Prints the event information onto the console.
          */
-        virtual void processEvent() = 0;
+        virtual void processEvent() const = 0;
 
         /**
          * Destructor for the event. All subclasses must override this method
@@ -64,4 +64,18 @@ class Event {
          * @return A deep copy of other Event.
          */
         static Event *clone(Event *other);
+
+        /**
+         * Writes the given event in binary form (see BinaryIO): its type, time, plane and runway ID if it has one.
+         * @param out : The binary output stream.
+         * @param event : The event to be written.
+         */
+        static void write(std::ostream& out, Event *event);
+
+        /**
+         * Reads an event written by Event::write(std::ostream&, Event *).
+         * @param in : The binary input stream.
+         * @return A heap-allocated event of the same type, owned by the caller.
+         */
+        static Event *read(std::istream& in);
 };
\ No newline at end of file
@@ -11,7 +11,8 @@
  */
 EventNode::EventNode(Event *event) {
 	this->event = event;
-	this->next = nullptr;
+	this->queueNext = nullptr;
+	this->queueChild = nullptr;
 }
 
 /**
@@ -30,22 +31,6 @@ Event* EventNode::getEvent() const {
 	return this->event;
 }
 
-/**
- * Sets this node's link to point to the input EventNode.
- * @param next : the node to be linked with this node.
- */
-void EventNode::setNext(EventNode *next) {
-	this->next = next;
-}
-
-/**
- * Retrieves the next EventNode that is currently linked with this node.
- * @return the next node that this EventNode is referencing to.
- */
-EventNode* EventNode::getNext() const {
-	return this->next;
-}
-
 /**
  * Deallocates the event associated with this node then deletes the node itself.
  */
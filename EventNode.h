@@ -1,18 +1,18 @@
 #pragma once
 
 #include "Event.h"
+#include "PriorityQueue.h"
 
 /**
- * This class represents a single node for the EventPriorityQueue class. It consists of a reference to an Event pointer 
- * and a link to the next node, with getters and setters for encapsulation.
+ * This class represents a single node for the EventPriorityQueue class. It consists of a reference to an Event pointer
+ * with getters and setters for encapsulation, and the hook linking it into the PriorityQueue of the EventPriorityQueue.
  * @author Student name: Duc Cam Thai, Student number: 7851908
  */
-class EventNode {
+class EventNode : public PriorityQueueHook<EventNode> {
 
     private:
 
         Event* event;    //The event associating with this node.
-        EventNode* next; //The link to the next event node.
 
     public:
 
@@ -34,18 +34,6 @@ class EventNode {
          */
         Event *getEvent() const;
 
-        /**
-         * Sets this node's link to point to the input EventNode.
-         * @param next : the node to be linked with this node.
-         */
-        void setNext(EventNode *next);
-
-        /**
-         * Retrieves the next EventNode that is currently linked with this node.
-         * @return the next node that this EventNode is referencing to.
-         */
-        EventNode *getNext() const;
-
         /**
          * Deallocates the event associated with this node then deletes the node itself.
          */
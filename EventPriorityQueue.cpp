@@ -1,6 +1,6 @@
 /**
  * This file is the implementation of the EventPriorityQueue.h blueprint.
- * This class uses an ordered linked list structure ADT to keep track of all events.
+ * This class uses a PriorityQueue of EventNodes (an ordered linked list) to keep track of all events.
  * @author: Student name: Duc Cam Thai, Student number: 7851908
  */
 
@@ -9,12 +9,32 @@
 #include "RequestLandingEvent.h"
 #include "RequestTakeoffEvent.h"
 #include "CompleteEvent.h"
+#include "BinaryIO.h"
 
 /**
  * Constructs an empty queue.
  */
 EventPriorityQueue::EventPriorityQueue() {
-	this->head = nullptr;
+	spareNodes = nullptr;
+}
+
+/**
+ * Constructs a deep copy of the input queue. Every event is cloned (see Event::clone(Event *)) and kept in the
+ * same order. The clones are linked in a linear time, since they are already in order.
+ * @param other : The queue to be copied.
+ */
+EventPriorityQueue::EventPriorityQueue(const EventPriorityQueue& other) {
+
+	spareNodes = nullptr;
+	std::vector<EventNode *> nodes; //The nodes of the other queue, front first
+	other.queue.inOrder(nodes);
+
+	//Replaces every node by a clone of its event, then links the clones in the same order:
+	for (size_t i = 0; i < nodes.size(); i++) {
+		nodes[i] = new EventNode(Event::clone(nodes[i]->getEvent()));
+	}
+	queue.assign(nodes);
+
 }
 
 /**
@@ -62,41 +82,69 @@ static bool samePriority(Event *event1, Event *event2) {
 }
 
 /**
- * First while loop condition to traverse. The condition evaluates to true if the input event has later time
- * compared to the event stored in currentNode and the currentNode is not null.
- * @param event : the input event to be evaluated.
- * @param currentNode : the current node data to be evaluated.
- * @return true if the currentNode is not null and the input event has later time to the event stored in this node.
+ * Orders the nodes of the queue by the priority given in the class' information.
+ * @param node1 : first input node
+ * @param node2 : second input node
+ * @return true if the event of the first node has strictly higher priority than the event of the second node.
+ */
+bool EventPriorityQueue::Before::operator()(const EventNode& node1, const EventNode& node2) const {
+	return precedes(node1.getEvent(), node2.getEvent());
+}
+
+/**
+ * Checks if the first event would be dequeued before the second event if both were in the same queue. The priority
+ * used is the one given in the class' information.
+ * @param event1 : first input event
+ * @param event2 : second input event
+ * @return true if the first event has strictly higher priority than the second event.
  */
-static bool firstTraversal(Event *event, EventNode *currentNode) {
-	return currentNode != nullptr && compareTime(event, currentNode->getEvent()) > 0;
+bool EventPriorityQueue::precedes(Event *event1, Event *event2) {
+
+	//Earlier events always come first:
+	if (compareTime(event1, event2) != 0) {
+		return compareTime(event1, event2) < 0;
+	}
+
+	//Same time: landings come before takeoffs, then the lower ATC ID comes first:
+	if (!samePriority(event1, event2)) {
+		return lowerPriority(event2, event1);
+	}
+	return compareID(event1, event2) < 0;
+
 }
 
 /**
- * Second while loop condition to traverse. The condition evaluates to true if the input plane has the same time but
- * lower priority compared to the event stored in currentNode and the currentNode is not null.
- * @param event : the input event to be evaluated.
- * @param currentNode : the current node data to be evaluated.
- * @return true if the currentNode is not null and the input plane has the same time but lower priority
- * compared to the plane stored in this node.
+ * Retrieves a node holding the given event, reusing a spare node if there is one, so that an enqueue does not
+ * cost a call to the allocator once the queue has grown to the number of events pending at the same time.
+ * @param event : The event associated with the node.
+ * @return The node of the event.
  */
-static bool secondTraversal(Event *event, EventNode *currentNode) {
-	return currentNode != nullptr && compareTime(event, currentNode->getEvent()) == 0 
-		&& lowerPriority(event, currentNode->getEvent());
+EventNode *EventPriorityQueue::createNode(Event *event) {
+
+	if (spareNodes == nullptr) {
+		return new EventNode(event);
+	}
+
+	EventNode *node = spareNodes;
+	spareNodes = node->queueNext;
+	node->setEvent(event);
+	return node;
+
 }
 
 /**
- * Final while loop condition to traverse. The condition evaluates to true if the input event has the same priority,
- * same time but has plane with higher ATC ID compared to the event stored in currentNode and the currentNode is not null.
- * @param event : the input event to be evaluated.
- * @param currentNode : the current node data to be evaluated.
- * @return true if the currentNode is not null and the input event has the same priority and same request time but
- * has plane with higher ATC ID compared to the event stored in this node.
+ * Detaches the event of a node removed from the queue, then keeps the node for the next enqueues.
+ * @param node : The node removed from the queue.
+ * @return The event of the node, now owned by the caller.
  */
-static bool finalTraversal(Event *event, EventNode *currentNode) {
-	return currentNode != nullptr && compareTime(event, currentNode->getEvent()) == 0 
-		&& samePriority(event, currentNode->getEvent())
-		&& compareID(event, currentNode->getEvent()) > 0;
+Event *EventPriorityQueue::recycle(EventNode *node) {
+
+	Event *event = node->getEvent();
+	node->setEvent(nullptr);
+	node->queueNext = spareNodes;
+	spareNodes = node;
+	return event;
+
 }
 
 /**
@@ -107,52 +155,8 @@ static bool finalTraversal(Event *event, EventNode *currentNode) {
  */
 bool EventPriorityQueue::enqueue(Event* event) {
 
-	//Allocates the memory for the new node:
-	EventNode *newNode = new EventNode(event);
-
-	if (this->isEmpty()) {
-
-		//If the list is empty, proceeds to set the front node directly:
-        head = newNode;
-
-	} else {
-
-		EventNode* curr = head; //Current node
-		EventNode *prev = nullptr; //Previous node
-
-		//First while loop:
-		while (firstTraversal(event, curr)) {
-			prev = curr;
-			curr = curr->getNext();
-		}
-
-		//Second while loop:
-		while (secondTraversal(event, curr)) {
-            prev = curr;
-            curr = curr->getNext();
-        }
-
-		//Final while loop:
-		while (finalTraversal(event, curr)) {
-            prev = curr;
-            curr = curr->getNext();
-        }
-
-		if (prev == nullptr) {
-
-			//If the index of insertion is at the front, proceeds to set newNode as head.
-            newNode->setNext(head);
-            head = newNode;
-
-
-        } else {
-
-			//Puts the node in between prev and curr:
-            newNode->setNext(curr);
-            prev->setNext(newNode);
-
-        }
-	}
+	//Takes a node for the event, then lets the queue link it at its spot:
+	queue.push(createNode(event));
 
 	//Returns true by default:
 	return true;
@@ -160,7 +164,7 @@ bool EventPriorityQueue::enqueue(Event* event) {
 }
 
 /**
- * Removes the first event in this queue. The copy to this event is returned.
+ * Removes the first event in this queue. The event itself is returned and must be deleted by the caller.
  * @return The event removed at the front.
  */
 Event* EventPriorityQueue::dequeue() {
@@ -170,30 +174,88 @@ Event* EventPriorityQueue::dequeue() {
 
 }
 
+/**
+ * Removes every event at the front of this queue that happens at the same time as the first one. The events are
+ * appended to the batch in priority order and must be deleted by the caller. They are cut off the front of the list
+ * in one piece (see the popWhile method of the SortedList backend).
+ * @param batch : The list receiving the removed events.
+ * @return The number of events removed.
+ */
+int EventPriorityQueue::dequeueBatch(std::vector<Event *>& batch) {
+
+	int count = 0; //The number of events removed
+	if (this->isEmpty()) {
+		return count;
+	}
+
+	//Cuts the front events sharing the time of the first one off the list at once:
+	int time = queue.top()->getEvent()->getTime();
+	EventNode *node = queue.popWhile([time](const EventNode& front) {
+		return front.getEvent()->getTime() == time;
+	});
+
+	//Hands the events of the detached nodes over to the batch, then keeps the nodes for the next enqueues:
+	while (node != nullptr) {
+		EventNode *next = node->queueNext;
+		batch.push_back(recycle(node));
+		node = next;
+		count++;
+	}
+
+	return count;
+
+}
+
 /**
  * Retrieves the event at the front of this queue.
  * @return The event at the front.
  */
 Event *EventPriorityQueue::peek() {
-    return this->head->getEvent();
+    return queue.top()->getEvent();
 }
 
 /**
- * Helper method to help dequeue the first event without losing the event's content into the memory.
+ * Helper method to help dequeue the first event without losing the event's content into the memory. The event is
+ * detached from its node, so the caller owns it from now on.
  * @return Sees Event::dequeue() method
  */
 Event *EventPriorityQueue::unlink() {
 
-	//Creates a temporary node, then shifts front:
-    EventNode* temp = head;
-    head = head->getNext();
+	//Removes the front node from the queue, then detaches its event and keeps the node for the next enqueues:
+	return recycle(queue.pop());
 
-	//Creates a clone of this event, then deletes this temp node:
-	Event* copy = Event::clone(temp->getEvent());
-	delete temp;
+}
+
+/**
+ * Writes every event of this queue in binary form, from front to back (see Event::write(std::ostream&, Event *)).
+ * @param out : The binary output stream.
+ */
+void EventPriorityQueue::write(std::ostream& out) const {
 
-	//Returns this copied event:
-	return copy;
+	std::vector<EventNode *> nodes; //The nodes of this queue, front first
+	queue.inOrder(nodes);
+
+	BinaryIO::writeInt(out, nodes.size());
+	for (size_t i = 0; i < nodes.size(); i++) {
+		Event::write(out, nodes[i]->getEvent());
+	}
+
+}
+
+/**
+ * Reads the events written by EventPriorityQueue::write(std::ostream&) into this queue, which must be empty. They
+ * were written front first, so they are linked in a linear time.
+ * @param in : The binary input stream.
+ */
+void EventPriorityQueue::read(std::istream& in) {
+
+	int count = BinaryIO::readInt(in); //The number of events to be read
+	std::vector<EventNode *> nodes; //The nodes read, front first
+
+	for (int i = 0; i < count; i++) {
+		nodes.push_back(createNode(Event::read(in)));
+	}
+	queue.assign(nodes);
 
 }
 
@@ -202,7 +264,7 @@ Event *EventPriorityQueue::unlink() {
  * @return true if this queue is empty, false otherwise.
  */
 bool EventPriorityQueue::isEmpty() const {
-    return this->head == nullptr;
+    return queue.empty();
 }
 
 /**
@@ -211,20 +273,17 @@ bool EventPriorityQueue::isEmpty() const {
  */
 EventPriorityQueue::~EventPriorityQueue() {
 
-	EventNode *current = this->head; //Current node
-    EventNode *next = nullptr; //Next node
-
-	//While loop to delete all the nodes:
-    while (current != nullptr) {
-
-		//Assigns next to next node from current:
-        next = current->getNext();
-
-		//Deletes the current node, then traverse to the next node:
-        delete current;
-        current = next;
+	//Deletes every node left (along with its event):
+	while (!queue.empty()) {
+		delete queue.pop();
+	}
 
-    }
+	//Deletes the spare nodes (they hold no event):
+	while (spareNodes != nullptr) {
+		EventNode *next = spareNodes->queueNext;
+		delete spareNodes;
+		spareNodes = next;
+	}
 
 }
 
@@ -233,11 +292,12 @@ EventPriorityQueue::~EventPriorityQueue() {
  */
 void EventPriorityQueue::debug() {
 
-	EventNode *current = this->head; //Current node
+	std::vector<EventNode *> nodes; //The nodes of this queue, front first
+	queue.inOrder(nodes);
+
+	//For loop to prints the list information onto the console:
+	for (size_t i = 0; i < nodes.size(); i++) {
+		nodes[i]->getEvent()->processEvent();
+	}
 
-	//While loop to prints the list information onto the console:
-    while (current != nullptr) {
-		current->getEvent()->processEvent();
-		current = current->getNext();
-    }
 }
\ No newline at end of file
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <vector>
+
 #include "Event.h"
 #include "EventNode.h"
+#include "PriorityQueue.h"
 
 /**
  * The priority queue used to keep track of each event canonically. The queue is automaticaly sorted by this priority:
@@ -14,7 +17,8 @@
  *      - If both events share the same time and have the same request type, the order in ID assigned by the Air Traffic 
  *      Control for the plane associating with each event is considered in ascending order.
  * 
- * Each dequeue call will automatically returns the event.
+ * Each dequeue call will automatically returns the event. The events are kept in a PriorityQueue of EventNodes, backed by
+ * an ordered linked list since the queue only holds a few events at a time (the next request and one event per runway).
  * 
  * @author Student name: Duc Cam Thai Student number: 7851908.
  */
@@ -22,10 +26,34 @@ class EventPriorityQueue {
 
     private:
 
-        EventNode* head; //The front of this queue (updated from each dequeue call).
+        /**
+         * Orders the nodes of the queue by the priority given in the class' information.
+         */
+        struct Before {
+            bool operator()(const EventNode& node1, const EventNode& node2) const;
+        };
+
+        PriorityQueue<EventNode, Before, SortedList> queue; //The nodes of the events, front first.
+        EventNode *spareNodes; //The nodes freed by the dequeues, linked through queueNext and reused by the enqueues.
 
         /**
-         * Helper method to help dequeue the first event without losing the event's content into the memory.
+         * Retrieves a node holding the given event, reusing a spare node if there is one, so that an enqueue does not
+         * cost a call to the allocator once the queue has grown to the number of events pending at the same time.
+         * @param event : The event associated with the node.
+         * @return The node of the event.
+         */
+        EventNode *createNode(Event *event);
+
+        /**
+         * Detaches the event of a node removed from the queue, then keeps the node for the next enqueues.
+         * @param node : The node removed from the queue.
+         * @return The event of the node, now owned by the caller.
+         */
+        Event *recycle(EventNode *node);
+
+        /**
+         * Helper method to help dequeue the first event without losing the event's content into the memory. The event is
+         * detached from its node, so the caller owns it from now on.
          * @return Sees Event::dequeue() method
          */
         Event* unlink();
@@ -36,6 +64,12 @@ class EventPriorityQueue {
          * Constructs an empty queue.
          */
         EventPriorityQueue();
+        /**
+         * Constructs a deep copy of the input queue. Every event is cloned (see Event::clone(Event *)) and kept in the
+         * same order. The clones are linked in a linear time, since they are already in order.
+         * @param other : The queue to be copied.
+         */
+        EventPriorityQueue(const EventPriorityQueue& other);
 
         /**
          * Adds the event into this priority queue. The priority is given in the class' information. It traverses
@@ -46,11 +80,20 @@ class EventPriorityQueue {
         bool enqueue(Event *event);
 
         /**
-         * Removes the first event in this queue. The copy to this event is returned.
+         * Removes the first event in this queue. The event itself is returned and must be deleted by the caller.
          * @return The event removed at the front.
          */
         Event* dequeue();
 
+        /**
+         * Removes every event at the front of this queue that happens at the same time as the first one. The events are
+         * appended to the batch in priority order and must be deleted by the caller. They are cut off the front of the list
+         * in one piece (see the popWhile method of the SortedList backend).
+         * @param batch : The list receiving the removed events.
+         * @return The number of events removed.
+         */
+        int dequeueBatch(std::vector<Event *>& batch);
+
         /**
          * Retrieves the event at the front of this queue.
          * @return The event at the front.
@@ -63,6 +106,26 @@ class EventPriorityQueue {
          */
         bool isEmpty() const;
 
+        /**
+         * Checks if the first event would be dequeued before the second event if both were in the same queue. The priority
+         * used is the one given in the class' information.
+         * @param event1 : first input event
+         * @param event2 : second input event
+         * @return true if the first event has strictly higher priority than the second event.
+         */
+        static bool precedes(Event *event1, Event *event2);
+        /**
+         * Writes every event of this queue in binary form, from front to back (see Event::write(std::ostream&, Event *)).
+         * @param out : The binary output stream.
+         */
+        void write(std::ostream& out) const;
+        /**
+         * Reads the events written by EventPriorityQueue::write(std::ostream&) into this queue, which must be empty. They
+         * were written front first, so they are linked in a linear time.
+         * @param in : The binary input stream.
+         */
+        void read(std::istream& in);
+
         /**
          * Prints out the queue in the pattern from front to back. Used for debugging purposes only.
          */
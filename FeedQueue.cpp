@@ -0,0 +1,92 @@
+/**
+ * This file is the implementation of the FeedQueue.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "FeedQueue.h"
+
+/**
+ * Constructs an empty queue. The capacity is rounded up to the next power of two.
+ * @param capacity : The number of messages that this queue can hold.
+ */
+FeedQueue::FeedQueue(size_t capacity) : head(0), tail(0) {
+    size_t size = 2;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    slots = new Slot[size];
+    mask = size - 1;
+
+    //Every slot starts free for the first lap of the producers:
+    for (size_t i = 0; i < size; i++) {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * Adds a message at the back of this queue. Can be called by any number of producer threads at once.
+ * @param entry : The message to be added.
+ * @return true if the message was added, false if the queue is full.
+ */
+bool FeedQueue::push(const FeedEntry& entry) {
+
+    size_t back = tail.load(std::memory_order_relaxed);
+    Slot *slot;
+
+    //Claims the slot at the tail, unless the consumer has not freed it yet (the queue is full):
+    while (true) {
+        slot = &slots[back & mask];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        if (sequence == back) {
+            if (tail.compare_exchange_weak(back, back + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (sequence < back) {
+            return false;
+        } else {
+            back = tail.load(std::memory_order_relaxed);
+        }
+    }
+
+    //Fills the slot first, then publishes it to the consumer:
+    slot->entry = entry;
+    slot->sequence.store(back + 1, std::memory_order_release);
+    return true;
+
+}
+
+/**
+ * Removes the message at the front of this queue. Must only be called by the consumer thread.
+ * @param entry : The message receiving the front of this queue.
+ * @return true if a message was removed, false if the queue is empty (or its front is still being filled).
+ */
+bool FeedQueue::pop(FeedEntry& entry) {
+
+    Slot *slot = &slots[head & mask];
+
+    if (slot->sequence.load(std::memory_order_acquire) != head + 1) {
+        return false;
+    }
+
+    //Copies the slot first, then gives it back to the producers for their next lap:
+    entry = slot->entry;
+    slot->sequence.store(head + mask + 1, std::memory_order_release);
+    head++;
+    return true;
+
+}
+
+/**
+ * Indicates if the message at the front of this queue can be removed. Must only be called by the consumer thread.
+ * @return true if a message is ready to be removed, false otherwise.
+ */
+bool FeedQueue::ready() const {
+    return slots[head & mask].sequence.load(std::memory_order_acquire) == head + 1;
+}
+
+/**
+ * Deallocates the storage of this queue.
+ */
+FeedQueue::~FeedQueue() {
+    delete[] slots;
+}
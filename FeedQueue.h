@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include "Plane.h"
+
+/**
+ * One message of a feed: either a request, or a promise that the feed has no more requests before a given time.
+ */
+struct FeedEntry {
+    int feed; //The index of the feed sending this message.
+    bool request; //Whether this message is a request (otherwise it only moves the watermark of the feed).
+    int watermark; //The time before which the feed has no more requests (INT_MAX once the feed is closed).
+    Plane plane; //The plane of the request (only for a request).
+};
+
+/**
+ * A bounded lock-free queue of feed messages shared by any number of producer threads and exactly one consumer thread.
+ * Each slot has its own sequence number telling whose turn it is: a producer claims the next slot by moving the tail
+ * with a compare-and-swap, fills it, then hands it to the consumer by bumping its sequence, so a slow producer never
+ * blocks the other ones and the consumer never waits for a lock.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class FeedQueue {
+
+    private:
+
+        /**
+         * A slot of the queue with its sequence number.
+         */
+        struct Slot {
+            std::atomic<size_t> sequence; //The position that can be pushed (equal) or popped (one more) in this slot
+            FeedEntry entry; //The message stored in this slot
+        };
+
+        Slot *slots; //The storage of this queue.
+        size_t mask; //The capacity minus one (the capacity is a power of two).
+        size_t head; //The number of messages popped so far (only used by the consumer).
+        char padding[64]; //Keeps head and tail on different cache lines so the consumer does not fight with the producers.
+        std::atomic<size_t> tail; //The number of slots claimed by the producers so far.
+
+    public:
+
+        /**
+         * Constructs an empty queue. The capacity is rounded up to the next power of two.
+         * @param capacity : The number of messages that this queue can hold.
+         */
+        FeedQueue(size_t capacity);
+
+        /**
+         * Adds a message at the back of this queue. Can be called by any number of producer threads at once.
+         * @param entry : The message to be added.
+         * @return true if the message was added, false if the queue is full.
+         */
+        bool push(const FeedEntry& entry);
+
+        /**
+         * Removes the message at the front of this queue. Must only be called by the consumer thread.
+         * @param entry : The message receiving the front of this queue.
+         * @return true if a message was removed, false if the queue is empty (or its front is still being filled).
+         */
+        bool pop(FeedEntry& entry);
+
+        /**
+         * Indicates if the message at the front of this queue can be removed. Must only be called by the consumer thread.
+         * @return true if a message is ready to be removed, false otherwise.
+         */
+        bool ready() const;
+
+        /**
+         * Deallocates the storage of this queue.
+         */
+        ~FeedQueue();
+
+};
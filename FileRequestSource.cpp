@@ -0,0 +1,103 @@
+/**
+ * This file is the implementation of the FileRequestSource.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "FileRequestSource.h"
+
+/**
+ * Opens the input file.
+ * @param fileName : The name of the input file.
+ */
+FileRequestSource::FileRequestSource(const std::string& fileName) : fileName(fileName), inputFile(fileName) {
+    nextId = 1;
+    completeLinesOnly = false;
+}
+
+/**
+ * Opens the input file at the given position, for example the one returned by FileRequestSource::getOffset().
+ * @param fileName : The name of the input file.
+ * @param offset : The byte offset of the next line to be read.
+ * @param nextId : The ATC ID of the request on that line.
+ */
+FileRequestSource::FileRequestSource(const std::string& fileName, std::streamoff offset, int nextId)
+    : fileName(fileName), inputFile(fileName) {
+    this->nextId = nextId;
+    completeLinesOnly = false;
+    if (offset < 0) {
+        inputFile.setstate(std::ios::eofbit | std::ios::failbit);
+    } else {
+        inputFile.seekg(offset);
+    }
+}
+
+/**
+ * Reads the next line of the input file and creates the plane making this request.
+ * @param plane : The plane receiving the next request.
+ * @return true if a request was read, false if it is EOF.
+ */
+bool FileRequestSource::next(Plane& plane) {
+
+    std::string line; //The line read from the file
+
+    if (completeLinesOnly) {
+
+        std::streamoff start = inputFile.tellg(); //The beginning of the line
+
+        //A line that reaches the end of the file has no line break yet, so it is read again next time:
+        if (!std::getline(inputFile, line) || inputFile.eof()) {
+            inputFile.clear();
+            inputFile.seekg(start);
+            return false;
+        }
+
+    } else if (!std::getline(inputFile, line)) {
+        return false;
+    }
+
+    plane = Plane::parse(line, nextId++);
+    return true;
+
+}
+
+/**
+ * Makes this source leave the last line of the file unread until it ends with a line break, so that a line being
+ * appended to the file by another program is never read half written. The offset then stays at the beginning of
+ * that line (see FileRequestSource::getOffset()).
+ * @param completeLinesOnly : true to only read the lines ending with a line break.
+ */
+void FileRequestSource::setCompleteLinesOnly(bool completeLinesOnly) {
+    this->completeLinesOnly = completeLinesOnly;
+}
+
+/**
+ * Reopens the input file at the position of the next line to be read.
+ * @return The heap-allocated copy, owned by the caller.
+ */
+RequestSource *FileRequestSource::fork() const {
+    FileRequestSource *copy = new FileRequestSource(fileName, getOffset(), nextId);
+    copy->setCompleteLinesOnly(completeLinesOnly);
+    return copy;
+}
+
+/**
+ * Returns the byte offset of the next line to be read, or -1 once the end of the file is reached.
+ * @return The position of the next request in the input file.
+ */
+std::streamoff FileRequestSource::getOffset() const {
+    //tellg() is not const, but it only reads the position of the stream:
+    return inputFile ? std::streamoff(const_cast<std::ifstream&>(inputFile).tellg()) : -1;
+}
+
+/**
+ * Returns the ATC ID that the next request will be given.
+ * @return The ATC ID of the next request.
+ */
+int FileRequestSource::getNextId() const {
+    return nextId;
+}
+
+/**
+ * Closes the input file.
+ */
+FileRequestSource::~FileRequestSource() {}
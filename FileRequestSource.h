@@ -0,0 +1,75 @@
+#pragma once
+
+#include <fstream>
+
+#include "RequestSource.h"
+
+/**
+ * Reads the requests directly from the input file, one line at a time, on the simulation thread. The line format is the
+ * one described in Plane::parse(const std::string&, int).
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class FileRequestSource : public RequestSource {
+
+    private:
+
+        std::string fileName; //The name of the input file
+        std::ifstream inputFile; //The input file stream associating with this source
+        int nextId; //The ATC ID of the next request
+        bool completeLinesOnly; //Whether a last line without a line break is left unread
+
+    public:
+
+        /**
+         * Opens the input file.
+         * @param fileName : The name of the input file.
+         */
+        FileRequestSource(const std::string& fileName);
+
+        /**
+         * Opens the input file at the given position, for example the one returned by FileRequestSource::getOffset().
+         * @param fileName : The name of the input file.
+         * @param offset : The byte offset of the next line to be read.
+         * @param nextId : The ATC ID of the request on that line.
+         */
+        FileRequestSource(const std::string& fileName, std::streamoff offset, int nextId);
+
+        /**
+         * Reads the next line of the input file and creates the plane making this request.
+         * @param plane : The plane receiving the next request.
+         * @return true if a request was read, false if it is EOF.
+         */
+        bool next(Plane& plane) override;
+
+        /**
+         * Makes this source leave the last line of the file unread until it ends with a line break, so that a line being
+         * appended to the file by another program is never read half written. The offset then stays at the beginning of
+         * that line (see FileRequestSource::getOffset()).
+         * @param completeLinesOnly : true to only read the lines ending with a line break.
+         */
+        void setCompleteLinesOnly(bool completeLinesOnly);
+
+        /**
+         * Reopens the input file at the position of the next line to be read.
+         * @return The heap-allocated copy, owned by the caller.
+         */
+        RequestSource *fork() const override;
+
+        /**
+         * Returns the byte offset of the next line to be read, or -1 once the end of the file is reached.
+         * @return The position of the next request in the input file.
+         */
+        std::streamoff getOffset() const;
+
+        /**
+         * Returns the ATC ID that the next request will be given.
+         * @return The ATC ID of the next request.
+         */
+        int getNextId() const;
+
+        /**
+         * Closes the input file.
+         */
+        ~FileRequestSource() override;
+
+};
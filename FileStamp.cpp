@@ -0,0 +1,88 @@
+/**
+ * This file is the implementation of the FileStamp.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "FileStamp.h"
+
+#include <stdexcept>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+/**
+ * Constructs the stamp of a missing file.
+ */
+FileStamp::FileStamp() {
+    this->size = -1;
+    this->modified = -1;
+}
+
+/**
+ * Constructs a stamp from its parts.
+ * @param size : The size of the file (in bytes).
+ * @param modified : The last modification time of the file.
+ */
+FileStamp::FileStamp(long long size, long long modified) {
+    this->size = size;
+    this->modified = modified;
+}
+
+/**
+ * Reads the current stamp of a file.
+ * @param fileName : The name of the file.
+ * @return The stamp of the file.
+ * @throws std::runtime_error if the file cannot be found.
+ */
+FileStamp FileStamp::of(const std::string& fileName) {
+
+    struct stat info; //The status of the file
+    if (stat(fileName.c_str(), &info) != 0) {
+        throw std::runtime_error("Cannot open " + fileName);
+    }
+
+    //Uses the nanoseconds where the system gives them, so a rewrite within the same second is noticed too:
+#if defined(__APPLE__)
+    long long modified = (long long) info.st_mtimespec.tv_sec * 1000000000LL + info.st_mtimespec.tv_nsec;
+#elif defined(__linux__)
+    long long modified = (long long) info.st_mtim.tv_sec * 1000000000LL + info.st_mtim.tv_nsec;
+#else
+    long long modified = (long long) info.st_mtime * 1000000000LL;
+#endif
+
+    return FileStamp(info.st_size, modified);
+
+}
+
+/**
+ * Retrieves the size of the file.
+ * @return The size (in bytes).
+ */
+long long FileStamp::getSize() const {
+    return size;
+}
+
+/**
+ * Retrieves the last modification time of the file.
+ * @return The last modification time.
+ */
+long long FileStamp::getModified() const {
+    return modified;
+}
+
+/**
+ * Checks if two stamps are the same, meaning that the file has not changed in between.
+ * @param other : The other stamp.
+ * @return true if both the size and the modification time are the same.
+ */
+bool FileStamp::operator==(const FileStamp& other) const {
+    return size == other.size && modified == other.modified;
+}
+
+/**
+ * Checks if two stamps differ, meaning that the file has changed in between.
+ * @param other : The other stamp.
+ * @return true if either the size or the modification time differs.
+ */
+bool FileStamp::operator!=(const FileStamp& other) const {
+    return !(*this == other);
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <string>
+
+/**
+ * The size and last modification time of a file, used to tell if a file has changed since something was built from it
+ * (a trace kept in memory, an index written next to the file).
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class FileStamp {
+
+    private:
+
+        long long size; //The size of the file (in bytes).
+        long long modified; //The last modification time of the file (in nanoseconds since the epoch, where available).
+
+    public:
+
+        /**
+         * Constructs the stamp of a missing file.
+         */
+        FileStamp();
+
+        /**
+         * Constructs a stamp from its parts.
+         * @param size : The size of the file (in bytes).
+         * @param modified : The last modification time of the file.
+         */
+        FileStamp(long long size, long long modified);
+
+        /**
+         * Reads the current stamp of a file.
+         * @param fileName : The name of the file.
+         * @return The stamp of the file.
+         * @throws std::runtime_error if the file cannot be found.
+         */
+        static FileStamp of(const std::string& fileName);
+
+        /**
+         * Retrieves the size of the file.
+         * @return The size (in bytes).
+         */
+        long long getSize() const;
+
+        /**
+         * Retrieves the last modification time of the file.
+         * @return The last modification time.
+         */
+        long long getModified() const;
+
+        /**
+         * Checks if two stamps are the same, meaning that the file has not changed in between.
+         * @param other : The other stamp.
+         * @return true if both the size and the modification time are the same.
+         */
+        bool operator==(const FileStamp& other) const;
+
+        /**
+         * Checks if two stamps differ, meaning that the file has changed in between.
+         * @param other : The other stamp.
+         * @return true if either the size or the modification time differs.
+         */
+        bool operator!=(const FileStamp& other) const;
+
+};
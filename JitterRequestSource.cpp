@@ -0,0 +1,45 @@
+/**
+ * This file is the implementation of the JitterRequestSource.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "JitterRequestSource.h"
+
+/**
+ * Constructs the jitter stage over the given feed.
+ * @param upstream : The original feed. This source takes ownership of it.
+ * @param model : The model drawing the jitters, which must outlive this source.
+ * @param replica : The number of the replica.
+ */
+JitterRequestSource::JitterRequestSource(RequestSource *upstream, const StochasticModel& model, int replica)
+    : model(model) {
+    this->upstream = upstream;
+    this->replica = replica;
+}
+
+/**
+ * Retrieves the next request of the feed with its time moved.
+ * @param plane : The plane receiving the next request.
+ * @return true if a request was retrieved, false if there are no more requests.
+ */
+bool JitterRequestSource::next(Plane& plane) {
+
+    Plane original; //The request of the original feed
+
+    if (!upstream->next(original)) {
+        return false;
+    }
+
+    int time = original.getRequestTime() + model.sampleJitter(replica, original.getAtcId());
+    plane = Plane(original.getAtcId(), original.getCallSign(), original.getFlightNumber(), original.getSize(),
+        original.getRequestType(), time);
+    return true;
+
+}
+
+/**
+ * Deletes the upstream feed.
+ */
+JitterRequestSource::~JitterRequestSource() {
+    delete upstream;
+}
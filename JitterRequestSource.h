@@ -0,0 +1,42 @@
+#pragma once
+
+#include "RequestSource.h"
+#include "StochasticModel.h"
+
+/**
+ * Moves the request time of every plane of a feed by a random number of minutes drawn by a StochasticModel for one
+ * replica. The feed is then only out of order by up to twice the jitter bound, so it is usually followed by a
+ * ReorderRequestSource with that window.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class JitterRequestSource : public RequestSource {
+
+    private:
+
+        RequestSource *upstream; //The original feed (owned by this source).
+        const StochasticModel& model; //The model drawing the jitters.
+        int replica; //The number of the replica.
+
+    public:
+
+        /**
+         * Constructs the jitter stage over the given feed.
+         * @param upstream : The original feed. This source takes ownership of it.
+         * @param model : The model drawing the jitters, which must outlive this source.
+         * @param replica : The number of the replica.
+         */
+        JitterRequestSource(RequestSource *upstream, const StochasticModel& model, int replica);
+
+        /**
+         * Retrieves the next request of the feed with its time moved.
+         * @param plane : The plane receiving the next request.
+         * @return true if a request was retrieved, false if there are no more requests.
+         */
+        bool next(Plane& plane) override;
+
+        /**
+         * Deletes the upstream feed.
+         */
+        ~JitterRequestSource() override;
+
+};
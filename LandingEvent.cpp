@@ -24,19 +24,10 @@ LandingEvent::LandingEvent(const LandingEvent& landingEvent) : ActionEvent(landi
  * Prints the event information onto the console. The following information is displayed for this event:
  * TIME: [time] -> [plane] cleared for landing on runway [runwayID] (time req. for landing: [totalTime])
  */
-void LandingEvent::processEvent() {
+void LandingEvent::processEvent() const {
 	std::cout << "TIME: " << this->startTime << " -> " << this->plane << " clear for landing on runway " << this->runwayID << " (time req. for landing: " << calculateTotalTime() << ")" << std::endl;
 }
 
-/**
- * Calculates the total amount of time needed for a plane to land and clear the runway. 
- * It is computed by the formula: totalTime = RUNWAY_USAGE + LOCATE_TIME + plane's turbulence duration.
- * @return The total time that the plane might use and clear the runway.
- */
-int LandingEvent::calculateTotalTime() {
-    return RUNWAY_USAGE + LOCATE_TIME + this->plane.getWakeTurbulenceDuration();
-}
-
 LandingEvent::~LandingEvent() {}
 
 
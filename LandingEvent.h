@@ -3,8 +3,6 @@
 #include "ActionEvent.h"
 #include "Runway.h"
 
-constexpr auto LOCATE_TIME = 2; //The amount of time that the plane needs to locate the runway on air.;
-
 /**
  * The event where the plane is allowed for landing. It consists of the time, plane and the runway ID that
  * this plane was allowed to find and land onto.
@@ -33,14 +31,7 @@ class LandingEvent : public ActionEvent {
          * Prints the event information onto the console. The following information is displayed for this event:
          * TIME: [time] -> [plane] cleared for landing on runway [runwayID] (time req. for landing: [totalTime])
          */
-        void processEvent() override;
-
-        /**
-         * Calculates the total amount of time needed for a plane to land and clear the runway. 
-         * It is computed by the formula: totalTime = RUNWAY_USAGE + LOCATE_TIME + plane's turbulence duration.
-         * @return The total time that the plane might use and clear the runway.
-         */
-        int calculateTotalTime() override;
+        void processEvent() const override;
 
         /**
          * Deallocates this event after it was done.
@@ -18,10 +18,36 @@
  */
 
 
+#include <csignal>
+
 #include "Simulation.h"
+#include "RunwayHeapSimulation.h"
+#include "ProcessSimulation.h"
+#include "FileRequestSource.h"
+#include "CoreBenchmark.h"
+#include "SweepSolver.h"
+#include "TraceSorter.h"
+#include "SimulationServer.h"
+#include "MetricsObserver.h"
+#include "PacedObserver.h"
+#include "MonteCarlo.h"
+#include "TraceLoader.h"
+#include "TimeWarpSimulation.h"
+#include "AirportNetwork.h"
+#include "BatchExecutor.h"
 
 constexpr auto TERMINATE_MESSAGE = "Program terminated normally";
 
+static SimulationServer *runningServer = nullptr; //The server of the server mode, stopped by SIGINT and SIGTERM.
+
+/**
+ * Signal handler of the server mode: asks the server to stop, so that it joins its workers and removes its socket.
+ * @param signal : The signal received.
+ */
+static void stopServer(int) {
+    runningServer->stop();
+}
+
 /**
  * Main method to execute our program. Here we use the argv array to input our file name and the number of runways 
  * along with the program execution command. The simulation object is then created to read these inputs and performs
@@ -39,17 +65,411 @@ int main(int argc, const char *argv[]) {
         exit(EXIT_FAILURE);
     }
 
+    //Sort mode: sorts an input file by request time into a new input file, then terminates:
+    if (std::string(argv[1]) == "--sort") {
+        if (argc < 4) {
+            std::cout << "Usage: " << argv[0] << " --sort [input_file] [output_file] [memory_MB]" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        long memory = argc > 4 ? std::stol(argv[4]) : DEFAULT_SORT_MEMORY; //The memory budget (in megabytes)
+        if (memory <= 0) {
+            std::cout << "The memory budget of --sort must be a positive number of megabytes" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        TraceSorter sorter(memory);
+        sorter.sort(argv[2], argv[3]);
+        printf("%s\n", TERMINATE_MESSAGE);
+        return EXIT_SUCCESS;
+    }
+
+    //Server mode: answers simulation queries on a local socket until the program is interrupted:
+    if (std::string(argv[1]) == "--serve") {
+        if (argc < 3) {
+            std::cout << "Usage: " << argv[0] << " --serve [socket_path] [workers]" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        SimulationServer server(argv[2], argc > 3 ? std::stoi(argv[3]) : 0);
+        runningServer = &server;
+        std::signal(SIGINT, stopServer);
+        std::signal(SIGTERM, stopServer);
+        server.serve();
+        printf("%s\n", TERMINATE_MESSAGE);
+        return EXIT_SUCCESS;
+    }
+
+    //Batch mode: runs every scenario of a manifest on a work-stealing pool, then terminates:
+    if (std::string(argv[1]) == "--batch") {
+        if (argc < 4) {
+            std::cout << "Usage: " << argv[0] << " --batch [manifest_file] [output_file] [workers]" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        BatchExecutor executor(argv[2], argc > 4 ? std::stoi(argv[4]) : 0);
+        executor.run(argv[3]);
+        executor.printSummary();
+        printf("%s\n", TERMINATE_MESSAGE);
+        return EXIT_SUCCESS;
+    }
+
+    //Network mode: simulates several airports exchanging flights, one thread per airport, then terminates:
+    if (std::string(argv[1]) == "--network") {
+        if (argc < 3) {
+            std::cout << "Usage: " << argv[0] << " --network [config_file]" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        AirportNetwork network(argv[2]);
+        network.run();
+        network.printSummary();
+        printf("%s\n", TERMINATE_MESSAGE);
+        return EXIT_SUCCESS;
+    }
+
     //Retrieves the input file and parses the runway into an integer:
     std::string fileName = argv[1];
     int runways = std::stoi(argv[2]);
 
-    //Creates an event based on the number of runways then passes this input file to run the simulation:
-    Simulation simulation(runways);
-    simulation.startSimulation(fileName);
+    //Reads the optional flags following the number of runways:
+    bool fused = false;
+    bool heap = false;
+    bool process = false;
+    bool bench = false;
+    bool fastSummary = false;
+    bool prefetch = false;
+    int loadThreads = -1;
+    int reorderWindow = -1;
+    std::string checkpointFile;
+    int checkpointInterval = 0;
+    bool resume = false;
+    std::string incrementalFile;
+    bool windowed = false;
+    int windowStart = 0;
+    int windowEnd = 0;
+    int warmup = -1;
+    std::string metricsFile;
+    int metricsInterval = 0;
+    int replicas = 0;
+    unsigned long long seed = 1;
+    int jitter = 0;
+    std::string service = "fixed:0";
+    int compareRunways = 0;
+    bool antithetic = false;
+    bool independent = false;
+    bool modelOptions = false; //Whether --seed, --jitter or --service was given
+    int timeWarp = -1;
+    std::vector<std::string> feeds;
+    double paced = 0;
+    for (int i = 3; i < argc; i++) {
+        std::string option = argv[i];
+        if (option == "--fused") {
+            fused = true;
+        } else if (option == "--heap") {
+            heap = true;
+        } else if (option == "--process") {
+            process = true;
+        } else if (option == "--bench") {
+            bench = true;
+        } else if (option == "--fast-summary") {
+            fastSummary = true;
+        } else if (option == "--prefetch") {
+            prefetch = true;
+        } else if (option == "--parallel-load") {
+            if (i + 1 == argc) {
+                std::cout << "Missing number of threads after " << option << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            loadThreads = std::stoi(argv[++i]);
+        } else if (option == "--reorder-window") {
+            if (i + 1 == argc) {
+                std::cout << "Missing number of minutes after " << option << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            reorderWindow = std::stoi(argv[++i]);
+        } else if (option == "--checkpoint") {
+            if (i + 2 >= argc) {
+                std::cout << "Missing checkpoint file and number of minutes after " << option << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            checkpointFile = argv[++i];
+            checkpointInterval = std::stoi(argv[++i]);
+        } else if (option == "--resume") {
+            resume = true;
+        } else if (option == "--incremental") {
+            if (i + 1 == argc) {
+                std::cout << "Missing state file after " << option << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            incrementalFile = argv[++i];
+        } else if (option == "--window") {
+            if (i + 2 >= argc) {
+                std::cout << "Missing start and end times after " << option << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            windowed = true;
+            windowStart = std::stoi(argv[++i]);
+            windowEnd = std::stoi(argv[++i]);
+        } else if (option == "--warmup") {
+            if (i + 1 == argc) {
+                std::cout << "Missing number of minutes after " << option << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            warmup = std::stoi(argv[++i]);
+            if (warmup < 0) {
+                std::cout << "--warmup needs a number of minutes >= 0" << std::endl;
+                exit(EXIT_FAILURE);
+            }
+        } else if (option == "--metrics") {
+            if (i + 2 >= argc) {
+                std::cout << "Missing metrics file and number of minutes after " << option << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            metricsFile = argv[++i];
+            metricsInterval = std::stoi(argv[++i]);
+        } else if (option == "--feed") {
+            if (i + 1 == argc) {
+                std::cout << "Missing input file after " << option << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            feeds.push_back(argv[++i]);
+        } else if (option == "--antithetic") {
+            antithetic = true;
+        } else if (option == "--independent") {
+            independent = true;
+        } else if (option == "--monte-carlo" || option == "--seed" || option == "--jitter" || option == "--service"
+            || option == "--compare" || option == "--time-warp" || option == "--paced") {
+            if (i + 1 == argc) {
+                std::cout << "Missing value after " << option << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            std::string value = argv[++i];
+            if (option == "--monte-carlo") {
+                replicas = std::stoi(value);
+                if (replicas <= 0) {
+                    std::cout << "--monte-carlo needs a positive number of replicas" << std::endl;
+                    exit(EXIT_FAILURE);
+                }
+            } else if (option == "--seed") {
+                seed = std::stoull(value);
+                modelOptions = true;
+            } else if (option == "--jitter") {
+                jitter = std::stoi(value);
+                modelOptions = true;
+            } else if (option == "--compare") {
+                compareRunways = std::stoi(value);
+            } else if (option == "--time-warp") {
+                timeWarp = std::stoi(value);
+            } else if (option == "--paced") {
+                paced = std::stod(value);
+            } else {
+                service = value;
+                modelOptions = true;
+            }
+        } else {
+            std::cout << "Unknown option: " << option << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
 
-    //Calculates the total wasted time and prints the summary of this simulation:
-    int wasted = simulation.getTotalWastedMinutes();
-    simulation.printSummary(runways, wasted);
+    //Checkpoints and incremental runs save the position in the input file, so it must be read line by line on the simulation
+    //thread:
+    if (resume && checkpointFile.empty()) {
+        std::cout << "--resume needs a checkpoint file (see --checkpoint)" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (!checkpointFile.empty() && (checkpointInterval <= 0 || heap || prefetch || loadThreads >= 0 || reorderWindow >= 0)) {
+        std::cout << "--checkpoint needs a positive number of minutes and cannot be used with --heap, --prefetch, "
+            << "--parallel-load or --reorder-window" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (!incrementalFile.empty() && (!checkpointFile.empty() || heap || prefetch || loadThreads >= 0 || reorderWindow >= 0)) {
+        std::cout << "--incremental cannot be used with --checkpoint, --heap, --prefetch, --parallel-load or --reorder-window"
+            << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (warmup >= 0 && !windowed) {
+        std::cout << "--warmup needs --window" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (windowed && (!checkpointFile.empty() || !incrementalFile.empty() || heap || fastSummary || prefetch || loadThreads >= 0
+        || reorderWindow >= 0)) {
+        std::cout << "--window cannot be used with --checkpoint, --incremental, --heap, --fast-summary, --prefetch, "
+            << "--parallel-load or --reorder-window" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if ((heap || fastSummary) && (fused || prefetch || loadThreads >= 0 || reorderWindow >= 0 || (heap && fastSummary))) {
+        std::cout << "--heap and --fast-summary cannot be used together, nor with --fused, --prefetch, --parallel-load or "
+            << "--reorder-window" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (!metricsFile.empty() && (metricsInterval <= 0 || heap || fastSummary)) {
+        std::cout << "--metrics needs a positive number of minutes and cannot be used with --heap or --fast-summary"
+            << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    if ((compareRunways != 0 || antithetic || independent || modelOptions) && replicas <= 0) {
+        std::cout << "--compare, --antithetic, --independent, --seed, --jitter and --service need --monte-carlo" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (replicas > 0 && (!checkpointFile.empty() || !incrementalFile.empty() || windowed || !metricsFile.empty() || heap
+        || fused || fastSummary || prefetch || loadThreads >= 0 || reorderWindow >= 0)) {
+        std::cout << "--monte-carlo cannot be used with --checkpoint, --incremental, --window, --metrics, --heap, --fused, "
+            << "--fast-summary, --prefetch, --parallel-load or --reorder-window" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (antithetic && replicas % 2 != 0) {
+        std::cout << "--antithetic needs an even number of replicas (they go by pairs)" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (compareRunways < 0 || (independent && compareRunways == 0)) {
+        std::cout << "--compare needs a positive number of runways, and --independent needs --compare" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    if (!feeds.empty() && (!checkpointFile.empty() || !incrementalFile.empty() || windowed || heap || fastSummary
+        || prefetch || loadThreads >= 0 || replicas > 0 || timeWarp >= 0)) {
+        std::cout << "--feed cannot be used with --checkpoint, --incremental, --window, --heap, --fast-summary, --prefetch, "
+            << "--parallel-load, --monte-carlo or --time-warp" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (paced < 0 || (paced > 0 && (heap || fastSummary || replicas > 0 || timeWarp >= 0))) {
+        std::cout << "--paced needs a positive number of milliseconds and cannot be used with --heap, --fast-summary, "
+            << "--monte-carlo or --time-warp" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (timeWarp >= 0 && (!checkpointFile.empty() || !incrementalFile.empty() || windowed || !metricsFile.empty() || heap
+        || fastSummary || replicas > 0 || fused || prefetch || reorderWindow >= 0)) {
+        std::cout << "--time-warp cannot be used with --checkpoint, --incremental, --window, --metrics, --heap, "
+            << "--fast-summary, --monte-carlo, --fused, --prefetch or --reorder-window" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    if (process && (fused || !checkpointFile.empty() || !incrementalFile.empty() || windowed || !metricsFile.empty() || heap
+        || fastSummary || prefetch || loadThreads >= 0 || reorderWindow >= 0 || replicas > 0 || timeWarp >= 0
+        || !feeds.empty() || paced > 0)) {
+        std::cout << "--process cannot be combined with any other option" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (bench && (process || fused || !checkpointFile.empty() || !incrementalFile.empty() || windowed || !metricsFile.empty()
+        || heap || fastSummary || prefetch || loadThreads >= 0 || reorderWindow >= 0 || replicas > 0 || timeWarp >= 0
+        || !feeds.empty() || paced > 0)) {
+        std::cout << "--bench cannot be combined with any other option" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    //Monte Carlo: runs the replicas silently on every core, then prints the mean total wasted time:
+    if (replicas > 0) {
+        std::vector<Plane> trace = TraceLoader::load(fileName);
+        StochasticModel model(seed, jitter, service);
+        model.setAntithetic(antithetic);
+        double mean;
+        double halfWidth;
+        std::vector<int> results = MonteCarlo(trace, runways, model).run(replicas);
+        MonteCarlo::summarize(results, antithetic, mean, halfWidth);
+        printf("The number of runways was %d\n", runways);
+        printf("The mean total amount of time wasted over %d replicas was %.1f minutes\n", replicas, mean);
+        printf("95%% confidence interval: [%.1f, %.1f] minutes\n", mean - halfWidth, mean + halfWidth);
+
+        //Paired comparison: the same replicas with the other number of runways see the same random numbers, unless
+        //--independent moves them to the next (even) block of replicas:
+        if (compareRunways > 0) {
+            int firstReplica = independent ? replicas + replicas % 2 : 0;
+            std::vector<int> compared = MonteCarlo(trace, compareRunways, model).run(replicas, 0, firstReplica);
+            MonteCarlo::summarize(compared, antithetic, mean, halfWidth);
+            printf("The number of runways compared was %d\n", compareRunways);
+            printf("The mean total amount of time wasted over %d replicas was %.1f minutes\n", replicas, mean);
+            printf("95%% confidence interval: [%.1f, %.1f] minutes\n", mean - halfWidth, mean + halfWidth);
+            for (int i = 0; i < replicas; i++) {
+                compared[i] -= results[i];
+            }
+            MonteCarlo::summarize(compared, antithetic, mean, halfWidth);
+            printf("The mean difference (%d runways - %d runways) was %.1f minutes\n", compareRunways, runways, mean);
+            printf("95%% confidence interval of the difference: [%.1f, %.1f] minutes\n", mean - halfWidth,
+                mean + halfWidth);
+        }
+
+        printf("%s\n", TERMINATE_MESSAGE);
+        return EXIT_SUCCESS;
+    }
+
+    //Benchmark: times the Simulation class against the instantiations of the SimulationCore:
+    if (bench) {
+        CoreBenchmark(fileName, runways).run();
+        return EXIT_SUCCESS;
+    }
+
+    //Fast summary: only prints the total wasted time computed by a single sweep over the file:
+    if (fastSummary) {
+        std::cout << SweepSolver::solve(fileName, runways) << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    int wasted; //The total wasted time of the simulation
+    PacedObserver *pacer = nullptr; //Passes the events on against the wall clock (only in paced mode)
+
+    if (timeWarp >= 0) {
+
+        //Runs the optimistic parallel engine over the whole trace, which only computes the total wasted time:
+        wasted = TimeWarpSimulation(runways, timeWarp).run(TraceLoader::load(fileName, std::max(loadThreads, 0)));
+
+    } else if (process) {
+
+        //Runs the process engine, where each plane is a single resumable process, which only computes the total wasted
+        //time:
+        FileRequestSource source(fileName);
+        wasted = ProcessSimulation(runways).run(source).totalWastedMinutes;
+
+    } else if (heap) {
+
+        //Runs the runway heap engine, which only computes the total wasted time:
+        RunwayHeapSimulation simulation(runways);
+        simulation.startSimulation(fileName);
+        wasted = simulation.getTotalWastedMinutes();
+
+    } else {
+
+        //Creates an event based on the number of runways then passes this input file to run the simulation:
+        Simulation simulation(runways);
+        simulation.setFusedMode(fused);
+        simulation.setPrefetchMode(prefetch);
+        simulation.setLoadThreads(loadThreads);
+        simulation.setReorderWindow(reorderWindow);
+        simulation.setFeeds(feeds);
+        simulation.setCheckpoint(checkpointFile, checkpointInterval);
+        simulation.setResume(resume);
+        simulation.setIncremental(incrementalFile);
+        if (windowed) {
+            simulation.setWindow(windowStart, windowEnd, std::max(warmup, 0));
+        }
+
+        //Writes the rolling metrics while still printing every event:
+        ConsoleObserver console;
+        MetricsObserver *metrics = nullptr;
+        if (!metricsFile.empty()) {
+            metrics = new MetricsObserver(metricsFile, metricsInterval, runways, &console);
+            if (windowed) {
+                metrics->setMeasureFrom(windowStart);
+            }
+            simulation.setObserver(metrics);
+        }
+
+        //Holds every event until it is due on the wall clock:
+        if (paced > 0) {
+            pacer = new PacedObserver(paced, metrics != nullptr ? (SimulationObserver *) metrics : &console);
+            simulation.setObserver(pacer);
+            simulation.setPacer(pacer);
+        }
+
+        simulation.startSimulation(fileName);
+        wasted = simulation.getTotalWastedMinutes();
+        delete metrics;
+
+    }
+
+    //Prints the summary of this simulation:
+    Simulation::printSummary(runways, wasted);
+    if (pacer != nullptr) {
+        pacer->printHistogram();
+        delete pacer;
+    }
 
     //Prints the terminate message:
     printf("%s\n", TERMINATE_MESSAGE);
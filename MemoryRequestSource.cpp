@@ -0,0 +1,45 @@
+/**
+ * This file is the implementation of the MemoryRequestSource.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "MemoryRequestSource.h"
+
+/**
+ * Constructs a source over the given range of planes, served in order.
+ * @param begin : The plane of the first request.
+ * @param end : One past the plane of the last request.
+ */
+MemoryRequestSource::MemoryRequestSource(const Plane *begin, const Plane *end) {
+    this->current = begin;
+    this->end = end;
+}
+
+/**
+ * Retrieves the next plane of the range.
+ * @param plane : The plane receiving the next request.
+ * @return true if a request was retrieved, false if the end of the range is reached.
+ */
+bool MemoryRequestSource::next(Plane& plane) {
+
+    if (current == end) {
+        return false;
+    }
+
+    plane = *current++;
+    return true;
+
+}
+
+/**
+ * Creates a source over the remaining planes. The planes are shared, not copied.
+ * @return The heap-allocated copy, owned by the caller.
+ */
+RequestSource *MemoryRequestSource::fork() const {
+    return new MemoryRequestSource(current, end);
+}
+
+/**
+ * Destroys this source. The planes themselves are left untouched.
+ */
+MemoryRequestSource::~MemoryRequestSource() {}
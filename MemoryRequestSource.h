@@ -0,0 +1,44 @@
+#pragma once
+
+#include "RequestSource.h"
+
+/**
+ * Serves requests that are already parsed and stored in memory, such as the planes loaded by TraceLoader. The planes
+ * are not copied, so they must outlive this source. Their ATC IDs are kept as they are.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class MemoryRequestSource : public RequestSource {
+
+    private:
+
+        const Plane *current; //The plane of the next request.
+        const Plane *end; //One past the plane of the last request.
+
+    public:
+
+        /**
+         * Constructs a source over the given range of planes, served in order.
+         * @param begin : The plane of the first request.
+         * @param end : One past the plane of the last request.
+         */
+        MemoryRequestSource(const Plane *begin, const Plane *end);
+
+        /**
+         * Retrieves the next plane of the range.
+         * @param plane : The plane receiving the next request.
+         * @return true if a request was retrieved, false if the end of the range is reached.
+         */
+        bool next(Plane& plane) override;
+
+        /**
+         * Creates a source over the remaining planes. The planes are shared, not copied.
+         * @return The heap-allocated copy, owned by the caller.
+         */
+        RequestSource *fork() const override;
+
+        /**
+         * Destroys this source. The planes themselves are left untouched.
+         */
+        ~MemoryRequestSource() override;
+
+};
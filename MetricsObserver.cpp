@@ -0,0 +1,154 @@
+/**
+ * This file is the implementation of the MetricsObserver.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "MetricsObserver.h"
+
+#include <limits>
+#include <stdexcept>
+
+/**
+ * Opens the output file (or FIFO) and writes the CSV header.
+ * @param fileName : The name of the file or FIFO receiving the metrics.
+ * @param interval : The number of simulated minutes of each window.
+ * @param numRunways : The number of runways of the simulation.
+ * @param next : The observer receiving the events afterwards, or nullptr if none.
+ */
+MetricsObserver::MetricsObserver(const std::string& fileName, int interval, int numRunways, SimulationObserver *next)
+    : output(fileName) {
+
+    if (!output) {
+        throw std::runtime_error("Cannot open " + fileName);
+    }
+    if (interval <= 0) {
+        throw std::invalid_argument("The metrics interval must be positive");
+    }
+
+    this->interval = interval;
+    this->numRunways = numRunways;
+    this->next = next;
+    started = false;
+    windowStart = 0;
+    lastTime = 0;
+    requests = 0;
+    completed = 0;
+    wasted = 0;
+    busyMinutes = 0;
+    waiting = 0;
+    onRunways = 0;
+    measureFrom = std::numeric_limits<int>::min();
+
+    output << "window_start,window_end,requests,completed,wasted_minutes,waiting,on_runways,runway_utilization" << std::endl;
+
+}
+
+/**
+ * Moves the clock to the time of the given event, writing the line of every window that ends before it.
+ * @param time : The time of the event.
+ */
+void MetricsObserver::advance(int time) {
+
+    //The first window is the one of the first event:
+    if (!started) {
+        started = true;
+        windowStart = time - ((time % interval) + interval) % interval;
+        lastTime = windowStart;
+    }
+
+    //Closes every window ending before this event (the runways stay as busy as they were until then):
+    while (time >= windowStart + interval) {
+        busyMinutes += (long long) onRunways * (windowStart + interval - lastTime);
+        lastTime = windowStart + interval;
+        writeWindow(windowStart + interval);
+    }
+
+    busyMinutes += (long long) onRunways * (time - lastTime);
+    lastTime = time;
+
+}
+
+/**
+ * Writes the line of the current window and starts the next one.
+ * @param windowEnd : The time when the current window ends.
+ */
+void MetricsObserver::writeWindow(int windowEnd) {
+
+    double capacity = (double) numRunways * (windowEnd - windowStart); //The runway minutes available during the window
+
+    output << windowStart << ',' << windowEnd << ',' << requests << ',' << completed << ',' << wasted << ','
+        << waiting << ',' << onRunways << ',' << (capacity > 0 ? busyMinutes / capacity : 0.0) << std::endl;
+
+    windowStart = windowEnd;
+    requests = 0;
+    completed = 0;
+    wasted = 0;
+    busyMinutes = 0;
+
+}
+
+/**
+ * Leaves the planes requesting before the given time (during a warm-up) out of the requests, completed and
+ * wasted_minutes columns, as they are left out of the totals of the simulation (see Simulation::setWindow).
+ * @param time : The earliest request time counted.
+ */
+void MetricsObserver::setMeasureFrom(int time) {
+    measureFrom = time;
+}
+
+/**
+ * Counts the request, then passes it on.
+ * @param event : The request event being handled.
+ */
+void MetricsObserver::onRequest(const RequestEvent& event) {
+    advance(event.getTime());
+    if (event.getPlane().getRequestTime() >= measureFrom) {
+        requests++;
+    }
+    waiting++;
+    if (next != nullptr) {
+        next->onRequest(event);
+    }
+}
+
+/**
+ * Counts the plane leaving the wait list for a runway and the time it waited, then passes it on.
+ * @param event : The takeoff or landing event being handled.
+ */
+void MetricsObserver::onAction(const ActionEvent& event) {
+    advance(event.getTime());
+    if (event.getPlane().getRequestTime() >= measureFrom) {
+        wasted += event.getTime() - event.getPlane().getRequestTime();
+    }
+    waiting--;
+    onRunways++;
+    if (next != nullptr) {
+        next->onAction(event);
+    }
+}
+
+/**
+ * Counts the plane clearing its runway, then passes it on.
+ * @param event : The complete event being handled.
+ */
+void MetricsObserver::onComplete(const CompleteEvent& event) {
+    advance(event.getTime());
+    if (event.getPlane().getRequestTime() >= measureFrom) {
+        completed++;
+    }
+    onRunways--;
+    if (next != nullptr) {
+        next->onComplete(event);
+    }
+}
+
+/**
+ * Writes the line of the last window, which ends with the last event.
+ */
+MetricsObserver::~MetricsObserver() {
+    if (started && lastTime > windowStart) {
+        writeWindow(lastTime);
+    } else if (started && (requests > 0 || completed > 0)) {
+        writeWindow(windowStart);
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <fstream>
+#include <string>
+
+#include "SimulationObserver.h"
+
+/**
+ * Writes rolling metrics of a running simulation every given number of simulated minutes, as one CSV line per window:
+ *
+ *      window_start,window_end,requests,completed,wasted_minutes,waiting,on_runways,runway_utilization
+ *
+ * where requests and completed are the numbers of planes that made a request and cleared their runway during the window,
+ * wasted_minutes is the time waited by the planes given a runway during the window, waiting and on_runways are the numbers of
+ * planes in the wait list and on the runways at the end of the window, and runway_utilization is the fraction of the
+ * runway time used during the window. Like the totals of the simulation, requests, completed and wasted_minutes leave out
+ * the planes that requested before the measured period (see MetricsObserver::setMeasureFrom(int)), while waiting,
+ * on_runways and runway_utilization describe every plane.
+ *
+ * Every counter is updated in constant time per event from the events alone, and each line is flushed as soon as its
+ * window ends, so the output can be a FIFO read while the simulation runs. The events are then passed on to the next
+ * observer (if any), such as the ConsoleObserver.
+ *
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class MetricsObserver : public SimulationObserver {
+
+    private:
+
+        std::ofstream output; //The file or FIFO receiving the metrics
+        int interval; //The number of simulated minutes of each window
+        int numRunways; //The number of runways of the simulation
+        SimulationObserver *next; //The observer receiving the events afterwards (nullptr if none)
+        bool started; //Whether an event has been seen yet
+        int windowStart; //The time when the current window starts
+        int lastTime; //The time of the last event seen
+        int requests; //The number of requests made during the current window
+        int completed; //The number of planes that cleared their runway during the current window
+        long long wasted; //The minutes waited by the planes cleared during the current window
+        long long busyMinutes; //The runway minutes used during the current window
+        int waiting; //The number of planes in the wait list
+        int onRunways; //The number of planes on a runway
+        int measureFrom; //The earliest request time counted in requests, completed and wasted_minutes
+
+        /**
+         * Moves the clock to the time of the given event, writing the line of every window that ends before it.
+         * @param time : The time of the event.
+         */
+        void advance(int time);
+
+        /**
+         * Writes the line of the current window and starts the next one.
+         * @param windowEnd : The time when the current window ends.
+         */
+        void writeWindow(int windowEnd);
+
+    public:
+
+        /**
+         * Opens the output file (or FIFO) and writes the CSV header.
+         * @param fileName : The name of the file or FIFO receiving the metrics.
+         * @param interval : The number of simulated minutes of each window.
+         * @param numRunways : The number of runways of the simulation.
+         * @param next : The observer receiving the events afterwards, or nullptr if none.
+         */
+        MetricsObserver(const std::string& fileName, int interval, int numRunways, SimulationObserver *next);
+
+        /**
+         * Leaves the planes requesting before the given time (during a warm-up) out of the requests, completed and
+         * wasted_minutes columns, as they are left out of the totals of the simulation (see Simulation::setWindow).
+         * @param time : The earliest request time counted.
+         */
+        void setMeasureFrom(int time);
+
+        /**
+         * Counts the request, then passes it on.
+         * @param event : The request event being handled.
+         */
+        void onRequest(const RequestEvent& event) override;
+
+        /**
+         * Counts the plane leaving the wait list for a runway and the time it waited, then passes it on.
+         * @param event : The takeoff or landing event being handled.
+         */
+        void onAction(const ActionEvent& event) override;
+
+        /**
+         * Counts the plane clearing its runway, then passes it on.
+         * @param event : The complete event being handled.
+         */
+        void onComplete(const CompleteEvent& event) override;
+
+        /**
+         * Writes the line of the last window, which ends with the last event.
+         */
+        ~MetricsObserver() override;
+
+};
@@ -0,0 +1,137 @@
+/**
+ * This file is the implementation of the MonteCarlo.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "MonteCarlo.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+
+#include "JitterRequestSource.h"
+#include "MemoryRequestSource.h"
+#include "ReorderRequestSource.h"
+#include "Simulation.h"
+
+constexpr auto CONFIDENCE_Z = 1.96; //The normal quantile of a 95% confidence interval
+
+/**
+ * Constructs the runner.
+ * @param trace : The planes of the trace, in time order (for example loaded by TraceLoader).
+ * @param numRunways : The number of runways of every replica.
+ * @param model : The model drawing the random numbers.
+ */
+MonteCarlo::MonteCarlo(const std::vector<Plane>& trace, int numRunways, const StochasticModel& model)
+    : trace(trace), model(model) {
+    this->numRunways = numRunways;
+}
+
+/**
+ * Runs one replica silently.
+ * @param replica : The number of the replica.
+ * @return The total wasted time of this replica.
+ */
+int MonteCarlo::runReplica(int replica) const {
+
+    //Moves the requests, then puts them back in time order (a request moves by at most the jitter either way). The planes
+    //keep their ATC IDs from the trace, so their service times are drawn with the same numbers whatever their new order:
+    RequestSource *source = new MemoryRequestSource(trace.data(), trace.data() + trace.size());
+    if (model.getJitter() > 0) {
+        source = new JitterRequestSource(source, model, replica);
+        source = new ReorderRequestSource(source, 2 * model.getJitter(), false);
+    }
+
+    Simulation simulation(numRunways);
+    simulation.setObserver(nullptr);
+    simulation.setStochasticModel(&model, replica);
+    int wasted = simulation.run(*source).totalWastedMinutes;
+
+    delete source;
+    return wasted;
+
+}
+
+/**
+ * Runs the replicas firstReplica to firstReplica + numReplicas - 1, handed out one at a time to the threads.
+ * @param numReplicas : The number of replicas.
+ * @param numThreads : The number of threads (0 uses every core).
+ * @param firstReplica : The number of the first replica (0 to share the random numbers with another run).
+ * @return The total wasted time of every replica, in replica order.
+ */
+std::vector<int> MonteCarlo::run(int numReplicas, unsigned numThreads, int firstReplica) const {
+
+    std::vector<int> results(std::max(numReplicas, 0));
+    std::atomic<int> nextReplica(0); //The next replica not taken by a thread yet
+    std::vector<std::thread> threads;
+
+    if (numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    numThreads = std::min<unsigned>(numThreads, results.size());
+
+    //Each thread takes the next replica until there are none left, writing its result in the slot of that replica:
+    for (unsigned i = 0; i < numThreads; i++) {
+        threads.push_back(std::thread([this, &results, &nextReplica, numReplicas, firstReplica]() {
+            int replica;
+            while ((replica = nextReplica++) < numReplicas) {
+                results[replica] = runReplica(firstReplica + replica);
+            }
+        }));
+    }
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+
+    return results;
+
+}
+
+/**
+ * Computes the mean of the given results and the half width of its 95% confidence interval (normal approximation).
+ * With antithetic pairs, the results of each pair are averaged first, since only the pairs are independent.
+ * @param results : The results of the replicas (or their differences between two configurations), in replica order.
+ * @param antithetic : Whether the replicas go by antithetic pairs.
+ * @param mean : Receives the mean.
+ * @param halfWidth : Receives the half width of the confidence interval (0 with fewer than two samples).
+ * @throws std::invalid_argument if the replicas go by antithetic pairs but their number is odd.
+ */
+void MonteCarlo::summarize(const std::vector<int>& results, bool antithetic, double& mean, double& halfWidth) {
+
+    //A lone replica at the end would be mixed in with the pair averages:
+    if (antithetic && results.size() % 2 != 0) {
+        throw std::invalid_argument("Antithetic replicas go by pairs, so their number must be even");
+    }
+
+    std::vector<double> samples; //The independent samples: the replicas, or the averages of the antithetic pairs
+    for (size_t i = 0; i < results.size(); i++) {
+        if (antithetic) {
+            samples.push_back((results[i] + results[i + 1]) / 2.0);
+            i++;
+        } else {
+            samples.push_back(results[i]);
+        }
+    }
+
+    double sum = 0;
+    for (size_t i = 0; i < samples.size(); i++) {
+        sum += samples[i];
+    }
+    mean = samples.empty() ? 0 : sum / samples.size();
+
+    if (samples.size() < 2) {
+        halfWidth = 0;
+        return;
+    }
+
+    //Sample variance, then the standard error of the mean:
+    double squares = 0;
+    for (size_t i = 0; i < samples.size(); i++) {
+        squares += (samples[i] - mean) * (samples[i] - mean);
+    }
+    double variance = squares / (samples.size() - 1);
+    halfWidth = CONFIDENCE_Z * std::sqrt(variance / samples.size());
+
+}
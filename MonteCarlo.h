@@ -0,0 +1,60 @@
+#pragma once
+
+#include <vector>
+
+#include "Plane.h"
+#include "StochasticModel.h"
+
+/**
+ * Runs many replicas of a stochastic simulation over the same trace, in parallel. Each replica moves the request times
+ * and draws the service times with its own numbers from the StochasticModel, so the total wasted time of a replica only
+ * depends on the seed and the replica number, not on the thread that ran it. The trace is parsed once and shared by
+ * every replica.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class MonteCarlo {
+
+    private:
+
+        const std::vector<Plane>& trace; //The planes of the trace, in time order
+        int numRunways; //The number of runways of every replica
+        const StochasticModel& model; //The model drawing the random numbers
+
+    public:
+
+        /**
+         * Constructs the runner.
+         * @param trace : The planes of the trace, in time order (for example loaded by TraceLoader).
+         * @param numRunways : The number of runways of every replica.
+         * @param model : The model drawing the random numbers.
+         */
+        MonteCarlo(const std::vector<Plane>& trace, int numRunways, const StochasticModel& model);
+
+        /**
+         * Runs one replica silently.
+         * @param replica : The number of the replica.
+         * @return The total wasted time of this replica.
+         */
+        int runReplica(int replica) const;
+
+        /**
+         * Runs the replicas firstReplica to firstReplica + numReplicas - 1, handed out one at a time to the threads.
+         * @param numReplicas : The number of replicas.
+         * @param numThreads : The number of threads (0 uses every core).
+         * @param firstReplica : The number of the first replica (0 to share the random numbers with another run).
+         * @return The total wasted time of every replica, in replica order.
+         */
+        std::vector<int> run(int numReplicas, unsigned numThreads = 0, int firstReplica = 0) const;
+
+        /**
+         * Computes the mean of the given results and the half width of its 95% confidence interval (normal approximation).
+         * With antithetic pairs, the results of each pair are averaged first, since only the pairs are independent.
+         * @param results : The results of the replicas (or their differences between two configurations), in replica order.
+         * @param antithetic : Whether the replicas go by antithetic pairs.
+         * @param mean : Receives the mean.
+         * @param halfWidth : Receives the half width of the confidence interval (0 with fewer than two samples).
+         * @throws std::invalid_argument if the replicas go by antithetic pairs but their number is odd.
+         */
+        static void summarize(const std::vector<int>& results, bool antithetic, double& mean, double& halfWidth);
+
+};
@@ -0,0 +1,291 @@
+/**
+ * This file is the implementation of the MultiFeedRequestSource.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "MultiFeedRequestSource.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "FileRequestSource.h"
+
+/**
+ * Orders the held requests so that the earliest one is at the top of the heap (request time, then feed, then the order
+ * of the feed).
+ * @param request1 : first held request
+ * @param request2 : second held request
+ * @return true if the first request comes after the second one.
+ */
+bool MultiFeedRequestSource::LaterRequest::operator()(const HeldRequest& request1, const HeldRequest& request2) const {
+    if (request1.plane.getRequestTime() != request2.plane.getRequestTime()) {
+        return request1.plane.getRequestTime() > request2.plane.getRequestTime();
+    }
+    if (request1.feed != request2.feed) {
+        return request1.feed > request2.feed;
+    }
+    return request1.order > request2.order;
+}
+
+/**
+ * Constructs the source for a fixed number of feeds, none of them open yet.
+ * @param numFeeds : The number of feeds.
+ * @param capacity : The number of messages that can wait for the simulation thread.
+ */
+MultiFeedRequestSource::MultiFeedRequestSource(int numFeeds, size_t capacity)
+    : queue(capacity), watermarks(numFeeds, std::numeric_limits<int>::min()), errors(numFeeds), stopping(false) {
+    received = 0;
+    nextId = 1;
+    releasedTime = std::numeric_limits<int>::min();
+    clockWatermark = std::numeric_limits<int>::min();
+}
+
+/**
+ * Pushes a request of a feed, unless the queue is full. Can be called from any thread, but each feed must only
+ * be pushed by one thread at a time, in time order.
+ * @param feed : The index of the feed.
+ * @param plane : The plane of the request (its ATC ID is replaced when it is released).
+ * @return true if the request was pushed, false if the queue is full.
+ */
+bool MultiFeedRequestSource::tryPush(int feed, const Plane& plane) {
+    if (!queue.push(FeedEntry{ feed, true, plane.getRequestTime(), plane })) {
+        return false;
+    }
+    messagesPushed.notify();
+    return true;
+}
+
+/**
+ * Pushes a message of a feed, sleeping while the queue is full, then wakes the simulation thread up.
+ * @param entry : The message to be pushed.
+ * @return true if the message was pushed, false if the adapter threads were stopped first.
+ */
+bool MultiFeedRequestSource::send(const FeedEntry& entry) {
+    bool pushed = false; //Whether the message went into the queue
+    messagesPopped.wait([&]() {
+        return (pushed = queue.push(entry)) || stopping.load(std::memory_order_relaxed);
+    });
+    if (pushed) {
+        messagesPushed.notify();
+    }
+    return pushed;
+}
+
+/**
+ * Pushes a request of a feed, waiting while the queue is full.
+ * @param feed : The index of the feed.
+ * @param plane : The plane of the request (its ATC ID is replaced when it is released).
+ */
+void MultiFeedRequestSource::push(int feed, const Plane& plane) {
+    FeedEntry entry = { feed, true, plane.getRequestTime(), plane };
+    send(entry);
+}
+
+/**
+ * Promises that a feed has no more requests before the given time, so that the other feeds are not held back by
+ * a quiet one. Waits while the queue is full.
+ * @param feed : The index of the feed.
+ * @param time : The time before which the feed has no more requests.
+ */
+void MultiFeedRequestSource::advance(int feed, int time) {
+    FeedEntry entry = { feed, false, time, Plane() };
+    send(entry);
+}
+
+/**
+ * Closes a feed: it has no more requests at all. Waits while the queue is full.
+ * @param feed : The index of the feed.
+ */
+void MultiFeedRequestSource::close(int feed) {
+    advance(feed, std::numeric_limits<int>::max());
+}
+
+/**
+ * Starts an adapter thread pushing every request of a file into a feed, then closing it.
+ * @param feed : The index of the feed.
+ * @param fileName : The name of the file, sorted by request time.
+ */
+void MultiFeedRequestSource::readFile(int feed, const std::string& fileName) {
+    adapters.push_back(std::thread(&MultiFeedRequestSource::read, this, feed, fileName));
+}
+
+/**
+ * Body of an adapter thread. Reads and parses each line of a file, then pushes it as a request of the feed.
+ * @param feed : The index of the feed.
+ * @param fileName : The name of the file.
+ */
+void MultiFeedRequestSource::read(int feed, const std::string& fileName) {
+
+    try {
+
+        FileRequestSource file(fileName);
+        Plane plane; //The plane of the request being passed
+        FeedEntry entry = { feed, true, 0, plane }; //The message of the request
+
+        while (file.next(entry.plane)) {
+            entry.watermark = entry.plane.getRequestTime();
+            if (!send(entry)) {
+                return;
+            }
+        }
+
+    } catch (...) {
+        errors[feed] = std::current_exception();
+    }
+
+    //Closes the feed (the error, if any, is published along with it):
+    send(FeedEntry{ feed, false, std::numeric_limits<int>::max(), Plane() });
+
+}
+
+/**
+ * Receives every message waiting in the queue, holding the requests and moving the watermarks.
+ */
+void MultiFeedRequestSource::receive() {
+
+    FeedEntry entry; //The message received
+    size_t first = received; //The number of messages received before this call
+
+    while (queue.pop(entry)) {
+
+        if (entry.watermark > watermarks[entry.feed]) {
+            watermarks[entry.feed] = entry.watermark;
+        }
+
+        if (entry.request) {
+            if (entry.plane.getRequestTime() < releasedTime) {
+                std::cerr << "Request " << entry.plane << " at time " << entry.plane.getRequestTime()
+                    << " of feed " << entry.feed << " arrived after a later request was released" << std::endl;
+            } else if (entry.plane.getRequestTime() < clockWatermark) {
+                std::cerr << "Request " << entry.plane << " at time " << entry.plane.getRequestTime()
+                    << " of feed " << entry.feed << " arrived after the wall clock had passed its time" << std::endl;
+            }
+            held.push(HeldRequest{ entry.plane, entry.feed, received });
+        } else if (entry.watermark == std::numeric_limits<int>::max() && errors[entry.feed]) {
+            std::rethrow_exception(errors[entry.feed]);
+        }
+        received++;
+
+    }
+
+    //Wakes up the feeds waiting for a free slot:
+    if (received != first) {
+        messagesPopped.notify();
+    }
+
+}
+
+/**
+ * Retrieves the time that every feed has moved past, either by itself or by the wall clock.
+ * @return The lowest watermark of the feeds, or INT_MAX once they are all closed.
+ */
+int MultiFeedRequestSource::getLowestWatermark() const {
+    return std::max(*std::min_element(watermarks.begin(), watermarks.end()), clockWatermark);
+}
+
+/**
+ * Indicates if next() can return without waiting: either the earliest request can be released, or every feed is
+ * closed and every request has been released.
+ * @return true if next() can return right away.
+ */
+bool MultiFeedRequestSource::releasable() const {
+    int lowest = getLowestWatermark(); //The time every feed has moved past
+    if (lowest == std::numeric_limits<int>::max()) {
+        return true;
+    }
+    //A feed can still send a request at the same time as the earliest one or earlier:
+    return !held.empty() && held.top().plane.getRequestTime() < lowest;
+}
+
+/**
+ * Releases the earliest request once every feed has moved past its time, waiting for the feeds if needed. Any
+ * error of an adapter thread is thrown here.
+ * @param plane : The plane receiving the next request.
+ * @return true if a request was released, false if every feed is closed and every request has been released.
+ */
+bool MultiFeedRequestSource::next(Plane& plane) {
+
+    while (!waitReady(std::chrono::steady_clock::time_point::max())) {}
+    if (held.empty()) {
+        return false;
+    }
+
+    //Releases the earliest request with the next ATC ID:
+    const Plane& earliest = held.top().plane;
+    plane = Plane(nextId++, earliest.getCallSign(), earliest.getFlightNumber(), earliest.getSize(),
+        earliest.getRequestType(), earliest.getRequestTime());
+    held.pop();
+    releasedTime = std::max(releasedTime, plane.getRequestTime());
+    return true;
+
+}
+
+/**
+ * Waits until a request can be released (or every feed is closed), until a feed sends a message or until the
+ * given wall time. The simulation thread sleeps on the signal of the feeds in the meantime.
+ * @param deadline : The wall time after which the caller stops waiting (a time already passed only checks).
+ * @return true if next() returns without waiting, false otherwise.
+ */
+bool MultiFeedRequestSource::waitReady(std::chrono::steady_clock::time_point deadline) {
+
+    auto arrived = [this]() {
+        return queue.ready();
+    };
+
+    receive();
+    if (releasable()) {
+        return true;
+    }
+
+    //Sleeps until a feed sends a message (or the deadline passes):
+    if (deadline == std::chrono::steady_clock::time_point::max()) {
+        messagesPushed.wait(arrived);
+    } else if (!messagesPushed.waitUntil(arrived, deadline)) {
+        return false;
+    }
+    receive();
+    return releasable();
+
+}
+
+/**
+ * Retrieves the time before which no request can be released anymore: the lower of the time that every feed has
+ * moved past and the time of the earliest request held.
+ * @return The watermark of this source.
+ */
+int MultiFeedRequestSource::getWatermark() {
+    receive();
+    int lowest = getLowestWatermark(); //The time every feed has moved past
+    return held.empty() ? lowest : std::min(lowest, held.top().plane.getRequestTime());
+}
+
+/**
+ * Retrieves the time of the earliest request held until every feed has moved past it.
+ * @return The time of that request, or INT_MAX if none is held.
+ */
+int MultiFeedRequestSource::getHeldTime() {
+    receive();
+    return held.empty() ? std::numeric_limits<int>::max() : held.top().plane.getRequestTime();
+}
+
+/**
+ * Moves every feed past the given time, as the wall clock of a paced simulation has reached it. The requests
+ * made at or before it that come in afterwards are reported as late.
+ * @param time : The simulated time reached by the wall clock.
+ */
+void MultiFeedRequestSource::passTime(int time) {
+    if (time < std::numeric_limits<int>::max()) {
+        clockWatermark = std::max(clockWatermark, time + 1);
+    }
+}
+
+/**
+ * Stops the adapter threads and waits for them to finish.
+ */
+MultiFeedRequestSource::~MultiFeedRequestSource() {
+    stopping.store(true, std::memory_order_relaxed);
+    messagesPopped.notify();
+    for (size_t i = 0; i < adapters.size(); i++) {
+        adapters[i].join();
+    }
+}
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "FeedQueue.h"
+#include "RequestSource.h"
+#include "WakeSignal.h"
+
+constexpr auto FEED_CAPACITY = 8192; //The default number of feed messages waiting for the simulation thread.
+
+/**
+ * Merges several live feeds (one per radar or operations source), each one producing its requests in time order on its
+ * own thread. The feeds push into one bounded FeedQueue; when it is full, they wait until the simulation catches up.
+ *
+ * Each feed has a watermark: the time before which it has no more requests, moved by its requests and by
+ * MultiFeedRequestSource::advance(int, int) when it is quiet. The simulation thread holds the requests in a heap and
+ * only releases the earliest one once every feed has moved past its time, so the requests come out in time order
+ * (then by feed, then in the order of each feed) with new ATC IDs from 1. It never takes a lock, except to sleep on a
+ * WakeSignal when it has to wait for the feeds (or a feed for a free slot).
+ *
+ * In a paced simulation, the wall clock moves every watermark as well (see MultiFeedRequestSource::passTime(int)): a
+ * feed that stays quiet past the time of an event no longer holds the others back.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class MultiFeedRequestSource : public RequestSource {
+
+    private:
+
+        /**
+         * A request held until every feed has moved past its time.
+         */
+        struct HeldRequest {
+            Plane plane; //The plane of the request
+            int feed; //The index of the feed that sent it
+            size_t order; //The number of messages received before it, to keep the order of each feed
+        };
+
+        /**
+         * Orders the held requests so that the earliest one is at the top of the heap.
+         */
+        struct LaterRequest {
+            bool operator()(const HeldRequest& request1, const HeldRequest& request2) const;
+        };
+
+        FeedQueue queue; //The messages of every feed, not received by the simulation thread yet.
+        std::vector<int> watermarks; //The watermark of each feed as received by the simulation thread.
+        std::priority_queue<HeldRequest, std::vector<HeldRequest>, LaterRequest> held; //The requests not released yet
+        size_t received; //The number of messages received by the simulation thread.
+        int nextId; //The ATC ID of the next request released.
+        int releasedTime; //The time of the last request released (the lowest int before the first one).
+        int clockWatermark; //The watermark given to every feed by the wall clock (the lowest int when not paced).
+        std::vector<std::exception_ptr> errors; //The error raised by the adapter thread of each feed (if any).
+        std::vector<std::thread> adapters; //The threads reading the feeds started by readFile.
+        std::atomic<bool> stopping; //Whether the adapter threads must stop early.
+        WakeSignal messagesPushed; //Rung by the feeds when they push a message.
+        WakeSignal messagesPopped; //Rung by the simulation thread when it frees slots of the queue or stops the adapters.
+
+        /**
+         * Receives every message waiting in the queue, holding the requests and moving the watermarks.
+         */
+        void receive();
+
+        /**
+         * Retrieves the time that every feed has moved past, either by itself or by the wall clock.
+         * @return The lowest watermark of the feeds, or INT_MAX once they are all closed.
+         */
+        int getLowestWatermark() const;
+
+        /**
+         * Indicates if next() can return without waiting: either the earliest request can be released, or every feed is
+         * closed and every request has been released.
+         * @return true if next() can return right away.
+         */
+        bool releasable() const;
+
+        /**
+         * Pushes a message of a feed, sleeping while the queue is full, then wakes the simulation thread up.
+         * @param entry : The message to be pushed.
+         * @return true if the message was pushed, false if the adapter threads were stopped first.
+         */
+        bool send(const FeedEntry& entry);
+
+        /**
+         * Body of an adapter thread. Reads and parses each line of a file, then pushes it as a request of the feed.
+         * @param feed : The index of the feed.
+         * @param fileName : The name of the file.
+         */
+        void read(int feed, const std::string& fileName);
+
+    public:
+
+        /**
+         * Constructs the source for a fixed number of feeds, none of them open yet.
+         * @param numFeeds : The number of feeds.
+         * @param capacity : The number of messages that can wait for the simulation thread.
+         */
+        MultiFeedRequestSource(int numFeeds, size_t capacity = FEED_CAPACITY);
+
+        /**
+         * Pushes a request of a feed, unless the queue is full. Can be called from any thread, but each feed must only
+         * be pushed by one thread at a time, in time order.
+         * @param feed : The index of the feed.
+         * @param plane : The plane of the request (its ATC ID is replaced when it is released).
+         * @return true if the request was pushed, false if the queue is full.
+         */
+        bool tryPush(int feed, const Plane& plane);
+
+        /**
+         * Pushes a request of a feed, waiting while the queue is full.
+         * @param feed : The index of the feed.
+         * @param plane : The plane of the request (its ATC ID is replaced when it is released).
+         */
+        void push(int feed, const Plane& plane);
+
+        /**
+         * Promises that a feed has no more requests before the given time, so that the other feeds are not held back by
+         * a quiet one. Waits while the queue is full.
+         * @param feed : The index of the feed.
+         * @param time : The time before which the feed has no more requests.
+         */
+        void advance(int feed, int time);
+
+        /**
+         * Closes a feed: it has no more requests at all. Waits while the queue is full.
+         * @param feed : The index of the feed.
+         */
+        void close(int feed);
+
+        /**
+         * Starts an adapter thread pushing every request of a file into a feed, then closing it.
+         * @param feed : The index of the feed.
+         * @param fileName : The name of the file, sorted by request time.
+         */
+        void readFile(int feed, const std::string& fileName);
+
+        /**
+         * Releases the earliest request once every feed has moved past its time, waiting for the feeds if needed. Any
+         * error of an adapter thread is thrown here.
+         * @param plane : The plane receiving the next request.
+         * @return true if a request was released, false if every feed is closed and every request has been released.
+         */
+        bool next(Plane& plane) override;
+
+        /**
+         * Waits until a request can be released (or every feed is closed), until a feed sends a message or until the
+         * given wall time. The simulation thread sleeps on the signal of the feeds in the meantime.
+         * @param deadline : The wall time after which the caller stops waiting (a time already passed only checks).
+         * @return true if next() returns without waiting, false otherwise.
+         */
+        bool waitReady(std::chrono::steady_clock::time_point deadline) override;
+
+        /**
+         * Retrieves the time before which no request can be released anymore: the lower of the time that every feed has
+         * moved past and the time of the earliest request held.
+         * @return The watermark of this source.
+         */
+        int getWatermark() override;
+
+        /**
+         * Retrieves the time of the earliest request held until every feed has moved past it.
+         * @return The time of that request, or INT_MAX if none is held.
+         */
+        int getHeldTime() override;
+
+        /**
+         * Moves every feed past the given time, as the wall clock of a paced simulation has reached it. The requests
+         * made at or before it that come in afterwards are reported as late.
+         * @param time : The simulated time reached by the wall clock.
+         */
+        void passTime(int time) override;
+
+        /**
+         * Stops the adapter threads and waits for them to finish.
+         */
+        ~MultiFeedRequestSource() override;
+
+};
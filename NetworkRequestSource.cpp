@@ -0,0 +1,105 @@
+/**
+ * This file is the implementation of the NetworkRequestSource.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "NetworkRequestSource.h"
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+/**
+ * Orders the arrivals so that the earliest request (then the lowest ATC ID) is at the top of the heap.
+ * @param plane1 : first arrival
+ * @param plane2 : second arrival
+ * @return true if the first arrival comes after the second one.
+ */
+bool NetworkRequestSource::LaterArrival::operator()(const Plane& plane1, const Plane& plane2) const {
+    if (plane1.getRequestTime() != plane2.getRequestTime()) {
+        return plane1.getRequestTime() > plane2.getRequestTime();
+    }
+    return plane1.getAtcId() > plane2.getAtcId();
+}
+
+/**
+ * Constructs the source over the feed of an airport. Nothing is let through until the horizon is set.
+ * @param upstream : The feed sorted by request time. This source takes ownership of it.
+ * @param idLimit : The first ATC ID of the arrivals, which the IDs of the feed must stay below.
+ */
+NetworkRequestSource::NetworkRequestSource(RequestSource *upstream, int idLimit) {
+    this->upstream = upstream;
+    this->idLimit = idLimit;
+    horizon = std::numeric_limits<int>::min();
+    readPending();
+}
+
+/**
+ * Reads the next request of the feed ahead.
+ * @throws std::runtime_error if its ATC ID reaches the IDs of the arrivals.
+ */
+void NetworkRequestSource::readPending() {
+    hasPending = upstream->next(pending);
+    if (hasPending && pending.getAtcId() >= idLimit) {
+        throw std::runtime_error("Too many requests in the input file of an airport: their ATC IDs would reach "
+            + std::to_string(idLimit) + ", the first ID of the planes flying in");
+    }
+}
+
+/**
+ * Adds the landing request of a plane flying in from another airport.
+ * @param plane : The plane, with its ATC ID and the time of its landing request.
+ */
+void NetworkRequestSource::deliver(const Plane& plane) {
+    arrivals.push(plane);
+}
+
+/**
+ * Sets the time of the last request that can be let through.
+ * @param horizon : The time up to which every arrival has been delivered.
+ */
+void NetworkRequestSource::setHorizon(int horizon) {
+    this->horizon = horizon;
+}
+
+/**
+ * Returns the time of the next request, whether it is before the horizon or not.
+ * @return The request time of the next request, or INT_MAX if there are none left.
+ */
+int NetworkRequestSource::getNextTime() const {
+    int time = hasPending ? pending.getRequestTime() : std::numeric_limits<int>::max();
+    if (!arrivals.empty() && arrivals.top().getRequestTime() < time) {
+        time = arrivals.top().getRequestTime();
+    }
+    return time;
+}
+
+/**
+ * Retrieves the next request, taking the feed first when it is made at the same time as an arrival.
+ * @param plane : The plane receiving the next request.
+ * @return true if a request was retrieved, false if there are none left up to the horizon.
+ * @throws std::runtime_error if the feed has so many requests that its ATC IDs reach the IDs of the arrivals.
+ */
+bool NetworkRequestSource::next(Plane& plane) {
+
+    if ((!hasPending && arrivals.empty()) || getNextTime() > horizon) {
+        return false;
+    }
+
+    if (hasPending && (arrivals.empty() || pending.getRequestTime() <= arrivals.top().getRequestTime())) {
+        plane = pending;
+        readPending();
+    } else {
+        plane = arrivals.top();
+        arrivals.pop();
+    }
+    return true;
+
+}
+
+/**
+ * Deletes the upstream feed.
+ */
+NetworkRequestSource::~NetworkRequestSource() {
+    delete upstream;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <queue>
+#include <vector>
+
+#include "RequestSource.h"
+
+/**
+ * The requests of one airport of an AirportNetwork: its own feed, merged in time order with the landing requests of the
+ * planes flying in from the other airports. Only the requests made up to the horizon are let through, since the flights
+ * landing after it may not have taken off yet; the source then reports no more requests until the horizon moves.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class NetworkRequestSource : public RequestSource {
+
+    private:
+
+        /**
+         * Orders the arrivals so that the earliest request (then the lowest ATC ID) is at the top of the heap.
+         */
+        struct LaterArrival {
+            bool operator()(const Plane& plane1, const Plane& plane2) const;
+        };
+
+        RequestSource *upstream; //The feed of this airport, sorted by request time (owned by this source).
+        Plane pending; //The next request of the feed, read ahead to be compared with the arrivals.
+        bool hasPending; //Whether the feed had a next request.
+        std::priority_queue<Plane, std::vector<Plane>, LaterArrival> arrivals; //The landing requests flying in
+        int horizon; //The time of the last request that can be let through.
+        int idLimit; //The ATC IDs of the feed must stay below this one, where the IDs of the arrivals start.
+
+        /**
+         * Reads the next request of the feed ahead.
+         * @throws std::runtime_error if its ATC ID reaches the IDs of the arrivals.
+         */
+        void readPending();
+
+    public:
+
+        /**
+         * Constructs the source over the feed of an airport. Nothing is let through until the horizon is set.
+         * @param upstream : The feed sorted by request time. This source takes ownership of it.
+         * @param idLimit : The first ATC ID of the arrivals, which the IDs of the feed must stay below.
+         */
+        NetworkRequestSource(RequestSource *upstream, int idLimit);
+
+        /**
+         * Adds the landing request of a plane flying in from another airport.
+         * @param plane : The plane, with its ATC ID and the time of its landing request.
+         */
+        void deliver(const Plane& plane);
+
+        /**
+         * Sets the time of the last request that can be let through.
+         * @param horizon : The time up to which every arrival has been delivered.
+         */
+        void setHorizon(int horizon);
+
+        /**
+         * Returns the time of the next request, whether it is before the horizon or not.
+         * @return The request time of the next request, or INT_MAX if there are none left.
+         */
+        int getNextTime() const;
+
+        /**
+         * Retrieves the next request, taking the feed first when it is made at the same time as an arrival.
+         * @param plane : The plane receiving the next request.
+         * @return true if a request was retrieved, false if there are none left up to the horizon.
+         * @throws std::runtime_error if the feed has so many requests that its ATC IDs reach the IDs of the arrivals.
+         */
+        bool next(Plane& plane) override;
+
+        /**
+         * Deletes the upstream feed.
+         */
+        ~NetworkRequestSource() override;
+
+};
@@ -0,0 +1,124 @@
+/**
+ * This file is the implementation of the PacedObserver.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "PacedObserver.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <thread>
+
+/**
+ * Constructs the observer.
+ * @param minuteLength : The number of milliseconds of wall time of one simulated minute.
+ * @param next : The observer receiving the events when they are due (nullptr if none).
+ */
+PacedObserver::PacedObserver(double minuteLength, SimulationObserver *next)
+    : minuteLength(minuteLength), histogram(LATENESS_BUCKETS, 0) {
+    this->next = next;
+    started = false;
+    startTime = 0;
+    events = 0;
+    totalLateness = 0;
+    maxLateness = 0;
+}
+
+/**
+ * Retrieves the wall time when the given simulated time is due. The first call (or the first event) sets the
+ * origin of the wall clock.
+ * @param time : The simulated time.
+ * @return The wall time on the steady clock.
+ */
+std::chrono::steady_clock::time_point PacedObserver::getDueTime(int time) {
+
+    //The first call sets the origin of the wall clock:
+    if (!started) {
+        started = true;
+        startTime = time;
+        wallStart = Clock::now();
+    }
+
+    return wallStart + std::chrono::duration_cast<Clock::duration>((time - startTime) * minuteLength);
+
+}
+
+/**
+ * Sleeps until the given event is due, then records how late it is.
+ * @param time : The time of the event.
+ */
+void PacedObserver::waitFor(int time) {
+
+    Clock::time_point due = getDueTime(time);
+    std::this_thread::sleep_until(due);
+
+    //Bucket 0 is under 1 microsecond, then bucket k holds [2^(k-1), 2^k) microseconds (the last one has no upper bound):
+    double lateness = std::chrono::duration<double, std::micro>(Clock::now() - due).count();
+    lateness = std::max(lateness, 0.0);
+    int bucket = 0;
+    while (bucket < LATENESS_BUCKETS - 1 && lateness >= (1LL << bucket)) {
+        bucket++;
+    }
+    histogram[bucket]++;
+    events++;
+    totalLateness += lateness;
+    maxLateness = std::max(maxLateness, lateness);
+
+}
+
+/**
+ * Passes the request event on once it is due.
+ * @param event : The request event being handled.
+ */
+void PacedObserver::onRequest(const RequestEvent& event) {
+    waitFor(event.getTime());
+    if (next != nullptr) {
+        next->onRequest(event);
+    }
+}
+
+/**
+ * Passes the takeoff or landing event on once it is due.
+ * @param event : The takeoff or landing event being handled.
+ */
+void PacedObserver::onAction(const ActionEvent& event) {
+    waitFor(event.getTime());
+    if (next != nullptr) {
+        next->onAction(event);
+    }
+}
+
+/**
+ * Passes the complete event on once it is due.
+ * @param event : The complete event being handled.
+ */
+void PacedObserver::onComplete(const CompleteEvent& event) {
+    waitFor(event.getTime());
+    if (next != nullptr) {
+        next->onComplete(event);
+    }
+}
+
+/**
+ * Prints the number of events, the mean and largest lateness and every bucket of the histogram onto the console.
+ */
+void PacedObserver::printHistogram() const {
+
+    printf("The number of events paced was %lld\n", events);
+    printf("The mean lateness was %.1f microseconds, the largest was %.1f microseconds\n",
+        events == 0 ? 0.0 : totalLateness / events, maxLateness);
+
+    //Prints every bucket that holds at least one event:
+    for (int i = 0; i < LATENESS_BUCKETS; i++) {
+        if (histogram[i] == 0) {
+            continue;
+        }
+        long long low = (i == 0) ? 0 : (1LL << (i - 1));
+        if (i == LATENESS_BUCKETS - 1) {
+            printf("    >= %lld us: %lld\n", low, histogram[i]);
+        } else {
+            printf("    [%lld, %lld) us: %lld\n", low, 1LL << i, histogram[i]);
+        }
+    }
+
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <chrono>
+#include <vector>
+
+#include "SimulationObserver.h"
+
+constexpr auto LATENESS_BUCKETS = 24; //The number of buckets of the lateness histogram (powers of two microseconds)
+
+/**
+ * Runs a simulation against the wall clock: each event is only passed on to the next observer (such as the
+ * ConsoleObserver) when it is due, one simulated minute lasting a given number of milliseconds from the first event.
+ * The simulation thread sleeps until then on the steady clock, without ever busy-waiting. A simulation waiting for a live
+ * source reads the same clock (see Simulation::setPacer(PacedObserver *)), so that it only waits until its next event
+ * is due.
+ *
+ * The lateness of each event (how long after its scheduled wall time it was actually passed on, because the thread woke
+ * up late or the simulation fell behind) is kept in a histogram whose buckets are powers of two microseconds.
+ *
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class PacedObserver : public SimulationObserver {
+
+    private:
+
+        typedef std::chrono::steady_clock Clock; //The high-resolution clock that never goes backwards
+
+        std::chrono::duration<double, std::milli> minuteLength; //The wall time of one simulated minute
+        SimulationObserver *next; //The observer receiving the events when they are due (nullptr if none)
+        bool started; //Whether an event has been seen yet
+        int startTime; //The simulated time of the first event
+        Clock::time_point wallStart; //The wall time when the first event was seen
+        std::vector<long long> histogram; //The number of events by bucket (bucket 0 is under 1 microsecond)
+        long long events; //The number of events paced
+        double totalLateness; //The sum of the lateness of every event, in microseconds
+        double maxLateness; //The largest lateness of an event, in microseconds
+
+        /**
+         * Sleeps until the given event is due, then records how late it is.
+         * @param time : The time of the event.
+         */
+        void waitFor(int time);
+
+    public:
+
+        /**
+         * Constructs the observer.
+         * @param minuteLength : The number of milliseconds of wall time of one simulated minute.
+         * @param next : The observer receiving the events when they are due (nullptr if none).
+         */
+        PacedObserver(double minuteLength, SimulationObserver *next);
+
+        /**
+         * Retrieves the wall time when the given simulated time is due. The first call (or the first event) sets the
+         * origin of the wall clock.
+         * @param time : The simulated time.
+         * @return The wall time on the steady clock.
+         */
+        std::chrono::steady_clock::time_point getDueTime(int time);
+
+        /**
+         * Passes the request event on once it is due.
+         * @param event : The request event being handled.
+         */
+        void onRequest(const RequestEvent& event) override;
+
+        /**
+         * Passes the takeoff or landing event on once it is due.
+         * @param event : The takeoff or landing event being handled.
+         */
+        void onAction(const ActionEvent& event) override;
+
+        /**
+         * Passes the complete event on once it is due.
+         * @param event : The complete event being handled.
+         */
+        void onComplete(const CompleteEvent& event) override;
+
+        /**
+         * Prints the number of events, the mean and largest lateness and every bucket of the histogram onto the console.
+         */
+        void printHistogram() const;
+
+};
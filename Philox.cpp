@@ -0,0 +1,53 @@
+/**
+ * This file is the implementation of the Philox.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "Philox.h"
+
+constexpr uint32_t PHILOX_M0 = 0xD2511F53; //The multiplier of the first pair of words
+constexpr uint32_t PHILOX_M1 = 0xCD9E8D57; //The multiplier of the second pair of words
+constexpr uint32_t PHILOX_W0 = 0x9E3779B9; //The increment of the first key word between rounds (golden ratio)
+constexpr uint32_t PHILOX_W1 = 0xBB67AE85; //The increment of the second key word between rounds (sqrt(3) - 1)
+constexpr auto PHILOX_ROUNDS = 10; //The number of rounds
+
+/**
+ * Generates the block of four random numbers of the given counter and key.
+ * @param counter : The four 32-bit words of the counter, replaced by the random numbers.
+ * @param key : The two 32-bit words of the key (usually the seed).
+ */
+void Philox::generate(uint32_t counter[4], const uint32_t key[2]) {
+
+    uint32_t key0 = key[0];
+    uint32_t key1 = key[1];
+
+    for (int round = 0; round < PHILOX_ROUNDS; round++) {
+
+        //Multiplies two words by the constants, keeping both halves of the 64-bit products:
+        uint64_t product0 = (uint64_t) PHILOX_M0 * counter[0];
+        uint64_t product1 = (uint64_t) PHILOX_M1 * counter[2];
+
+        //Mixes the halves with the other words and the key:
+        uint32_t word0 = (uint32_t) (product1 >> 32) ^ counter[1] ^ key0;
+        uint32_t word2 = (uint32_t) (product0 >> 32) ^ counter[3] ^ key1;
+        counter[1] = (uint32_t) product1;
+        counter[3] = (uint32_t) product0;
+        counter[0] = word0;
+        counter[2] = word2;
+
+        //Bumps the key for the next round:
+        key0 += PHILOX_W0;
+        key1 += PHILOX_W1;
+
+    }
+
+}
+
+/**
+ * Turns a 32-bit random number into a uniform number strictly between 0 and 1.
+ * @param bits : The random number.
+ * @return The uniform number.
+ */
+double Philox::toUniform(uint32_t bits) {
+    return (bits + 0.5) / 4294967296.0;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * The Philox4x32-10 counter-based random number generator. Instead of a state that moves forward with each draw, every
+ * block of four random numbers is a pure function of a 128-bit counter and a 64-bit key, so a draw can be made for any
+ * (replica, plane) pair in any order, on any thread, and always gives the same numbers.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class Philox {
+
+    public:
+
+        /**
+         * Generates the block of four random numbers of the given counter and key.
+         * @param counter : The four 32-bit words of the counter, replaced by the random numbers.
+         * @param key : The two 32-bit words of the key (usually the seed).
+         */
+        static void generate(uint32_t counter[4], const uint32_t key[2]);
+
+        /**
+         * Turns a 32-bit random number into a uniform number strictly between 0 and 1.
+         * @param bits : The random number.
+         * @return The uniform number.
+         */
+        static double toUniform(uint32_t bits);
+
+};
@@ -5,6 +5,10 @@
 
 #include "Plane.h"
 
+#include <sstream>
+
+#include "BinaryIO.h"
+
 /**
  * Private method to retrieve the Enum from the given string size.
  * @param size : the given string prompt for size.
@@ -148,6 +152,29 @@ int Plane::getWakeTurbulenceDuration() const {
     return (int) this->size;
 }
 
+/**
+ * Calculates the total amount of time that this plane occupies its runway once it is cleared (see
+ * Plane::calculateServiceTime(bool, int)). Every engine uses it, so they all agree on the service times.
+ * @return The total time that the plane might use and clear the runway.
+ */
+int Plane::getServiceTime() const {
+    return calculateServiceTime(isLanding(), getWakeTurbulenceDuration());
+}
+
+/**
+ * Calculates the total amount of time that a plane occupies its runway once it is cleared, by the formula:
+ * totalTime = RUNWAY_USAGE + plane's turbulence duration, plus LOCATE_TIME for a landing.
+ * @param landing : Whether the plane is landing (or taking off).
+ * @param wakeTurbulenceDuration : The wake turbulence duration of the plane (see getWakeTurbulenceDuration()).
+ * @return The total time that the plane might use and clear the runway.
+ */
+int Plane::calculateServiceTime(bool landing, int wakeTurbulenceDuration) {
+    if (landing) {
+        return RUNWAY_USAGE + LOCATE_TIME + wakeTurbulenceDuration;
+    }
+    return RUNWAY_USAGE + wakeTurbulenceDuration;
+}
+
 /**
  * Checks if the plane is requesting for takeoff or not.
  * @return true if the plane's requestType is indeed takeoff
@@ -164,6 +191,72 @@ bool Plane::isLanding() const {
     return this->requestType == "landing";
 }
 
+/**
+ * Creates a plane from one line of the input file. The line uses the following format:
+ *      [time] [callSign] [flightNumber] [size] [requestType]
+ * 
+ * where: 
+ *  [time]: an integer value representing the time (minute) of a plane requesting a runway.
+ *  [callSign]: is a string (guaranteed to be one token with no spaces) representing the airline.
+ *  [flightNumber]: is an integer value representing the flight number.
+ *  [size]: is a string representing the size of the plane. It can only be either small, large, heavy or super.
+ *  [requestType]: is a string representing what the plane is requesting. It can only be either takeoff or landing.
+ * 
+ * @param line : The input string containing the plane's information
+ * @param atcID : The Air Traffic Control ID assigned to this plane
+ * @return The plane described by this line.
+ */
+Plane Plane::parse(const std::string& line, int atcID) {
+
+    std::stringstream strstream(line); //The stream to token the input line
+    std::string token; //The tokens to be stored in each read
+    int time = 0; //The time where the request occurs
+    std::string callSign = ""; //The plane's callsign
+    int flightNum = 0; //The plane's flight number
+    std::string size = ""; //The size of this plane
+    std::string requestType = ""; //The request type for this plane
+
+    strstream >> token;  //grabbing the next token (reading time)
+    time = std::stoi(token); //converting time (string format) to an int
+    strstream >> callSign;  //grabbing the next token (reading call sign)
+    strstream >> token;
+    flightNum = stoi(token);  //grabbing the next token (reading flight number)
+    strstream >> size;  //grabbing the next token (reading plane size)
+    strstream >> requestType;  //grabbing the next token (reading request type, either landing or takeoff)
+
+    //Creates the plane based on the input parameters:
+    return Plane(atcID, callSign, flightNum, size, requestType, time);
+
+}
+
+/**
+ * Writes every field of this plane in binary form (see BinaryIO), for example into a checkpoint.
+ * @param out : The binary output stream.
+ */
+void Plane::write(std::ostream& out) const {
+    BinaryIO::writeInt(out, atcId);
+    BinaryIO::writeString(out, callSign);
+    BinaryIO::writeInt(out, flightNumber);
+    BinaryIO::writeString(out, getSize());
+    BinaryIO::writeString(out, requestType);
+    BinaryIO::writeInt(out, requestTime);
+}
+
+/**
+ * Reads a plane written by Plane::write(std::ostream&).
+ * @param in : The binary input stream.
+ * @return The plane read.
+ */
+Plane Plane::read(std::istream& in) {
+    int atcId = BinaryIO::readInt(in);
+    std::string callSign = BinaryIO::readString(in);
+    int flightNumber = BinaryIO::readInt(in);
+    std::string size = BinaryIO::readString(in);
+    std::string requestType = BinaryIO::readString(in);
+    int requestTime = BinaryIO::readInt(in);
+    return Plane(atcId, callSign, flightNumber, size, requestType, requestTime);
+}
+
 /**
  * Releases the plane's resource back to the memory
  */
@@ -4,6 +4,9 @@
 
 #include "Size.h"
 
+constexpr auto RUNWAY_USAGE = 1; //The amount of time spend on each runway (theoretical).;
+constexpr auto LOCATE_TIME = 2; //The amount of time that the plane needs to locate the runway on air.;
+
 /**
  * The planes that are used in the simulation. The planes are crucial in events creation and simulation.
  * @author: Student name: Duc Cam Thai, Student number: 7851908
@@ -101,6 +104,22 @@ class Plane {
          */
         int getWakeTurbulenceDuration() const;
 
+        /**
+         * Calculates the total amount of time that this plane occupies its runway once it is cleared (see
+         * Plane::calculateServiceTime(bool, int)). Every engine uses it, so they all agree on the service times.
+         * @return The total time that the plane might use and clear the runway.
+         */
+        int getServiceTime() const;
+
+        /**
+         * Calculates the total amount of time that a plane occupies its runway once it is cleared, by the formula:
+         * totalTime = RUNWAY_USAGE + plane's turbulence duration, plus LOCATE_TIME for a landing.
+         * @param landing : Whether the plane is landing (or taking off).
+         * @param wakeTurbulenceDuration : The wake turbulence duration of the plane (see getWakeTurbulenceDuration()).
+         * @return The total time that the plane might use and clear the runway.
+         */
+        static int calculateServiceTime(bool landing, int wakeTurbulenceDuration);
+
         /**
          * Prints the plane's information onto the given output stream. The method is tagged with the friend keyword to ensure
          * that the plane's information can be accessed directly.
@@ -122,6 +141,36 @@ class Plane {
          */
         bool isLanding() const;
 
+        /**
+         * Creates a plane from one line of the input file. The line uses the following format:
+         *      [time] [callSign] [flightNumber] [size] [requestType]
+         * 
+         * where: 
+         *  [time]: an integer value representing the time (minute) of a plane requesting a runway.
+         *  [callSign]: is a string (guaranteed to be one token with no spaces) representing the airline.
+         *  [flightNumber]: is an integer value representing the flight number.
+         *  [size]: is a string representing the size of the plane. It can only be either small, large, heavy or super.
+         *  [requestType]: is a string representing what the plane is requesting. It can only be either takeoff or landing.
+         * 
+         * @param line : The input string containing the plane's information
+         * @param atcID : The Air Traffic Control ID assigned to this plane
+         * @return The plane described by this line.
+         */
+        static Plane parse(const std::string& line, int atcID);
+
+        /**
+         * Writes every field of this plane in binary form (see BinaryIO), for example into a checkpoint.
+         * @param out : The binary output stream.
+         */
+        void write(std::ostream& out) const;
+
+        /**
+         * Reads a plane written by Plane::write(std::ostream&).
+         * @param in : The binary input stream.
+         * @return The plane read.
+         */
+        static Plane read(std::istream& in);
+
         /**
          * Releases the plane's resource back to the memory
          */
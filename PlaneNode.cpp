@@ -11,7 +11,8 @@
  */
 PlaneNode::PlaneNode(const Plane& plane) {
     this->plane = plane;
-    this->next = nullptr;
+    this->queueNext = nullptr;
+    this->queueChild = nullptr;
 }
 
 /**
@@ -22,14 +23,6 @@ void PlaneNode::setPlane(const Plane& newPlane) {
     this->plane = newPlane;
 }
 
-/**
- * Sets this node's link to point to the input PlaneNode.
- * @param newNext : the node to be linked with this node.
- */
-void PlaneNode::setNext(PlaneNode *newNext) {
-    this->next = newNext;
-}
-
 /**
  * Retrieves the plane's reference associating with this node.
  * @return The plane in this node.
@@ -38,14 +31,6 @@ const Plane &PlaneNode::getPlane() const {
     return this->plane;
 }
 
-/**
- * Retrieves the next PlaneNode that is currently linked with this node.
- * @return the next node that this PlaneNode is referencing to.
- */
-PlaneNode *PlaneNode::getNext() {
-    return this->next;
-}
-
 /**
  * Deallocates the node itself back to the memory.
  */
@@ -0,0 +1,87 @@
+/**
+ * This file is the implementation of the PlaneProcess.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "PlaneProcess.h"
+
+#include "ProcessSimulation.h"
+
+/**
+ * Constructs the process of a plane that has not made its request yet.
+ * @param plane : The plane.
+ */
+PlaneProcess::PlaneProcess(const Plane& plane) : plane(plane) {
+    phase = REQUEST;
+    runwayID = 0;
+}
+
+/**
+ * Carries on the process from where it stopped, until it has to wait again or is finished.
+ * @param simulation : The simulation running this process.
+ * @return true if the process is finished and can be destroyed.
+ */
+bool PlaneProcess::resume(ProcessSimulation& simulation) {
+
+    switch (phase) {
+
+        case REQUEST:
+
+            //Waits in line unless a runway is free right away (it is then handed over by the plane clearing it):
+            phase = OCCUPY;
+            if (!simulation.acquireRunway(*this)) {
+                return false;
+            }
+            //Falls through - the runway is given right away.
+
+        case OCCUPY:
+
+            //Takes off or lands, then waits until the runway is cleared:
+            phase = RELEASE;
+            simulation.hold(*this, plane.getServiceTime());
+            return false;
+
+        case RELEASE:
+
+            phase = DONE;
+            simulation.releaseRunway(*this);
+            return true;
+
+        default:
+            return true;
+
+    }
+
+}
+
+/**
+ * Retrieves the plane of this process.
+ * @return The plane.
+ */
+const Plane& PlaneProcess::getPlane() const {
+    return plane;
+}
+
+/**
+ * Retrieves the phase where this process carries on when it is resumed.
+ * @return The phase.
+ */
+PlaneProcess::Phase PlaneProcess::getPhase() const {
+    return phase;
+}
+
+/**
+ * Retrieves the runway given to the plane.
+ * @return The runway ID, or 0 if none yet.
+ */
+int PlaneProcess::getRunwayID() const {
+    return runwayID;
+}
+
+/**
+ * Gives a runway to the plane.
+ * @param runwayID : The runway ID.
+ */
+void PlaneProcess::setRunwayID(int runwayID) {
+    this->runwayID = runwayID;
+}
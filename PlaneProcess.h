@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Plane.h"
+
+class ProcessSimulation;
+
+/**
+ * The whole life of one plane in the ProcessSimulation, written as a single resumable function instead of separate
+ * request, action and complete events. The process runs until it has to wait (for a runway, or for the runway to be
+ * cleared), remembers where it stopped in its phase, and carries on from there the next time the simulation resumes it:
+ *
+ *  REQUEST:    asks for a runway, and waits in line until one is handed over
+ *  OCCUPY:     takes off or lands, holding the runway for the time it needs
+ *  RELEASE:    clears the runway, handing it over to the next plane in line
+ *
+ * A new phase (such as taxiing or waiting at a gate) only needs a new case in PlaneProcess::resume(ProcessSimulation&).
+ * The processes are created and destroyed by a ProcessPool, so a plane costs a single recycled block of memory.
+ *
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class PlaneProcess {
+
+    public:
+
+        /**
+         * The phases of a plane, in the order they happen.
+         */
+        enum Phase { REQUEST, OCCUPY, RELEASE, DONE };
+
+    private:
+
+        Plane plane; //The plane of this process.
+        Phase phase; //The phase where this process carries on when it is resumed.
+        int runwayID; //The runway given to the plane (0 if none yet).
+
+    public:
+
+        /**
+         * Constructs the process of a plane that has not made its request yet.
+         * @param plane : The plane.
+         */
+        PlaneProcess(const Plane& plane);
+
+        /**
+         * Carries on the process from where it stopped, until it has to wait again or is finished.
+         * @param simulation : The simulation running this process.
+         * @return true if the process is finished and can be destroyed.
+         */
+        bool resume(ProcessSimulation& simulation);
+
+        /**
+         * Retrieves the plane of this process.
+         * @return The plane.
+         */
+        const Plane& getPlane() const;
+
+        /**
+         * Retrieves the phase where this process carries on when it is resumed.
+         * @return The phase.
+         */
+        Phase getPhase() const;
+
+        /**
+         * Retrieves the runway given to the plane.
+         * @return The runway ID, or 0 if none yet.
+         */
+        int getRunwayID() const;
+
+        /**
+         * Gives a runway to the plane.
+         * @param runwayID : The runway ID.
+         */
+        void setRunwayID(int runwayID);
+
+};
@@ -0,0 +1,88 @@
+/**
+ * This file is the implementation of the PrefetchRequestSource.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "PrefetchRequestSource.h"
+
+#include "FileRequestSource.h"
+
+/**
+ * Starts the reader thread on the input file.
+ * @param fileName : The name of the input file.
+ * @param capacity : The number of parsed requests that can be read ahead.
+ */
+PrefetchRequestSource::PrefetchRequestSource(const std::string& fileName, size_t capacity)
+    : ring(capacity), finished(false), stopping(false) {
+    reader = std::thread(&PrefetchRequestSource::read, this, fileName);
+}
+
+/**
+ * Body of the reader thread. Reads and parses each line, then pushes it into the ring, waiting while the ring is full.
+ * @param fileName : The name of the input file.
+ */
+void PrefetchRequestSource::read(const std::string& fileName) {
+
+    try {
+
+        FileRequestSource file(fileName); //Parses the lines and assigns the ATC IDs in file order
+        Plane plane; //The plane of the request being passed
+
+        while (!stopping.load(std::memory_order_relaxed) && file.next(plane)) {
+
+            //Sleeps while the ring is full, unless the simulation stops the reader:
+            bool pushed = false; //Whether the plane went into the ring
+            requestsPopped.wait([&]() {
+                return (pushed = ring.push(plane)) || stopping.load(std::memory_order_relaxed);
+            });
+            if (!pushed) {
+                return;
+            }
+            requestsPushed.notify();
+
+        }
+
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    //Publishes the end of the file (and the error, if any) to the simulation thread:
+    finished.store(true, std::memory_order_release);
+    requestsPushed.notify();
+
+}
+
+/**
+ * Pops the next parsed request from the ring. Any parsing error of the reader thread is thrown here.
+ * @param plane : The plane receiving the next request.
+ * @return true if a request was retrieved, false if the whole file has been handled.
+ */
+bool PrefetchRequestSource::next(Plane& plane) {
+
+    //Sleeps until the reader pushes a request or finishes:
+    bool popped = false; //Whether a plane came out of the ring
+    requestsPushed.wait([&]() {
+        return (popped = ring.pop(plane)) || finished.load(std::memory_order_acquire);
+    });
+
+    //Once the reader is done, the ring is checked one last time since it may have pushed right before finishing:
+    if (!popped && !ring.pop(plane)) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return false;
+    }
+
+    requestsPopped.notify();
+    return true;
+
+}
+
+/**
+ * Stops the reader thread and waits for it to finish.
+ */
+PrefetchRequestSource::~PrefetchRequestSource() {
+    stopping.store(true, std::memory_order_relaxed);
+    requestsPopped.notify();
+    reader.join();
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <thread>
+
+#include "RequestSource.h"
+#include "RequestRing.h"
+#include "WakeSignal.h"
+
+constexpr auto PREFETCH_CAPACITY = 4096; //The default number of parsed requests read ahead of the simulation.
+
+/**
+ * Reads and parses the input file on a separate reader thread. The parsed requests are passed to the simulation thread
+ * through a RequestRing, so the simulation only pops the next request and never waits on the file unless the reader
+ * has fallen behind. A thread that has to wait (the simulation on an empty ring, the reader on a full one) sleeps on a
+ * WakeSignal rung by the other one.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class PrefetchRequestSource : public RequestSource {
+
+    private:
+
+        RequestRing ring; //The parsed requests waiting to be handled.
+        std::atomic<bool> finished; //Whether the reader thread has read the whole file.
+        std::atomic<bool> stopping; //Whether the reader thread must stop early.
+        std::exception_ptr error; //The error raised by the reader thread (if any).
+        std::thread reader; //The reader thread.
+        WakeSignal requestsPushed; //Rung by the reader thread when it pushes a request or finishes.
+        WakeSignal requestsPopped; //Rung by the simulation thread when it frees a slot of the ring or stops the reader.
+
+        /**
+         * Body of the reader thread. Reads and parses each line, then pushes it into the ring, waiting while the ring is full.
+         * @param fileName : The name of the input file.
+         */
+        void read(const std::string& fileName);
+
+    public:
+
+        /**
+         * Starts the reader thread on the input file.
+         * @param fileName : The name of the input file.
+         * @param capacity : The number of parsed requests that can be read ahead.
+         */
+        PrefetchRequestSource(const std::string& fileName, size_t capacity = PREFETCH_CAPACITY);
+
+        /**
+         * Pops the next parsed request from the ring. Any parsing error of the reader thread is thrown here.
+         * @param plane : The plane receiving the next request.
+         * @return true if a request was retrieved, false if the whole file has been handled.
+         */
+        bool next(Plane& plane) override;
+
+        /**
+         * Stops the reader thread and waits for it to finish.
+         */
+        ~PrefetchRequestSource() override;
+
+};
@@ -0,0 +1,431 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+/**
+ * The generic priority queue behind the EventPriorityQueue and the WaitList. It is a class template over three
+ * parameters, all chosen at compile time:
+ *
+ *      - Node: the type of the nodes, which derives from PriorityQueueHook<Node>. The queue is intrusive: it only links
+ *      the nodes it is given through their hook, it never allocates nor deletes them, so a node must not be in two queues
+ *      at once and must outlive its stay in the queue.
+ *
+ *      - Before: an ordering functor, where Before()(node1, node2) is true if node1 must come out before node2. It must be
+ *      a strict total order for the backends to agree on which node comes out first.
+ *
+ *      - Backend: the storage, one of SortedList (an ordered linked list), DaryHeap<D> (an implicit heap with D children
+ *      per node) or PairingHeap (a heap of linked nodes).
+ *
+ * Every backend offers the same operations: push(Node *), top(), pop(), empty(), size() and inOrder(std::vector<Node *>&).
+ *
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+
+/**
+ * The links that a node needs to sit in a PriorityQueue, whatever its backend. They are only used by the queue.
+ */
+template <typename Node>
+struct PriorityQueueHook {
+    Node *queueNext; //The next node of the list, or the next sibling in a pairing heap.
+    Node *queueChild; //The first child in a pairing heap.
+};
+
+/**
+ * Keeps the nodes in an ordered linked list: push walks from the front to its spot, pop takes the front in constant time.
+ * A new node goes before the nodes it is equal to. It is the fastest backend for short queues.
+ */
+struct SortedList {};
+
+/**
+ * Keeps the node pointers in an implicit heap of D children per node stored in a vector: push and pop take a logarithmic
+ * time, and a wider heap is shallower, so a pop touches fewer cache lines.
+ */
+template <unsigned D>
+struct DaryHeap {};
+
+/**
+ * Keeps the nodes in a pairing heap linked through their hooks: push takes a constant time, and pop merges the children of
+ * the front node two by two in an amortized logarithmic time. It suits long queues with many more pushes than pops at
+ * any given time.
+ */
+struct PairingHeap {};
+
+template <typename Node, typename Before, typename Backend = SortedList>
+class PriorityQueue;
+
+/**
+ * The PriorityQueue backed by an ordered linked list (see SortedList).
+ */
+template <typename Node, typename Before>
+class PriorityQueue<Node, Before, SortedList> {
+
+    private:
+
+        Node *head; //The front of this queue.
+        size_t count; //The number of nodes in this queue.
+
+    public:
+
+        /**
+         * Constructs an empty queue.
+         */
+        PriorityQueue() {
+            head = nullptr;
+            count = 0;
+        }
+
+        /**
+         * Adds a node into this queue, after every node that comes strictly before it.
+         * @param node : The node to be added.
+         */
+        void push(Node *node) {
+            Before before;
+            Node **link = &head; //The link where the node goes
+            while (*link != nullptr && before(**link, *node)) {
+                link = &(*link)->queueNext;
+            }
+            node->queueNext = *link;
+            *link = node;
+            count++;
+        }
+
+        /**
+         * Retrieves the node at the front of this queue.
+         * @return The node at the front, or nullptr if this queue is empty.
+         */
+        Node *top() const {
+            return head;
+        }
+
+        /**
+         * Removes the node at the front of this queue, which must not be empty.
+         * @return The node removed.
+         */
+        Node *pop() {
+            Node *front = head;
+            head = front->queueNext;
+            count--;
+            return front;
+        }
+
+        /**
+         * Removes the longest run of nodes at the front of this queue that all satisfy the predicate, with a single cut of
+         * the list. Only this backend offers it, since its nodes are already in order.
+         * @param keep : The predicate, where keep(node) is true if the node is removed.
+         * @return The first node removed (the others follow through their queueNext links, the last one links to nullptr),
+         * or nullptr if the front node does not satisfy the predicate.
+         */
+        template <typename Predicate>
+        Node *popWhile(Predicate keep) {
+            Node **link = &head; //The link after the last node removed
+            size_t removed = 0;
+            while (*link != nullptr && keep(**link)) {
+                link = &(*link)->queueNext;
+                removed++;
+            }
+            if (removed == 0) {
+                return nullptr;
+            }
+            Node *front = head;
+            head = *link;
+            *link = nullptr;
+            count -= removed;
+            return front;
+        }
+
+        /**
+         * Fills this queue, which must be empty, with nodes already in order, linking them one after the other in a linear
+         * time instead of walking the list for each of them. Only this backend offers it, since its nodes are already in
+         * order.
+         * @param nodes : The nodes to be added, front first.
+         */
+        void assign(const std::vector<Node *>& nodes) {
+            Node **link = &head; //The link where the next node goes
+            for (size_t i = 0; i < nodes.size(); i++) {
+                *link = nodes[i];
+                link = &nodes[i]->queueNext;
+            }
+            *link = nullptr;
+            count = nodes.size();
+        }
+
+        /**
+         * Indicates if this queue is empty or not.
+         * @return true if this queue is empty, false otherwise.
+         */
+        bool empty() const {
+            return head == nullptr;
+        }
+
+        /**
+         * Retrieves the number of nodes in this queue.
+         * @return The number of nodes.
+         */
+        size_t size() const {
+            return count;
+        }
+
+        /**
+         * Lists the nodes of this queue from front to back, without removing them.
+         * @param nodes : The list receiving the nodes.
+         */
+        void inOrder(std::vector<Node *>& nodes) const {
+            for (Node *current = head; current != nullptr; current = current->queueNext) {
+                nodes.push_back(current);
+            }
+        }
+
+};
+
+/**
+ * The PriorityQueue backed by an implicit heap of D children per node (see DaryHeap).
+ */
+template <typename Node, typename Before, unsigned D>
+class PriorityQueue<Node, Before, DaryHeap<D> > {
+
+    private:
+
+        std::vector<Node *> heap; //The nodes of this queue, each one before its D children.
+
+    public:
+
+        /**
+         * Adds a node into this queue, moving it up past every parent that it comes before.
+         * @param node : The node to be added.
+         */
+        void push(Node *node) {
+            Before before;
+            size_t hole = heap.size(); //The position where the node goes
+            heap.push_back(node);
+            while (hole > 0) {
+                size_t parent = (hole - 1) / D;
+                if (!before(*node, *heap[parent])) {
+                    break;
+                }
+                heap[hole] = heap[parent];
+                hole = parent;
+            }
+            heap[hole] = node;
+        }
+
+        /**
+         * Retrieves the node at the front of this queue.
+         * @return The node at the front, or nullptr if this queue is empty.
+         */
+        Node *top() const {
+            return heap.empty() ? nullptr : heap.front();
+        }
+
+        /**
+         * Removes the node at the front of this queue, which must not be empty. The last node takes its place and moves
+         * down past every child that comes before it.
+         * @return The node removed.
+         */
+        Node *pop() {
+
+            Before before;
+            Node *front = heap.front();
+            Node *last = heap.back();
+            heap.pop_back();
+            size_t size = heap.size();
+            if (size == 0) {
+                return front;
+            }
+
+            size_t hole = 0; //The position where the last node goes
+            while (true) {
+
+                //Finds the child that comes first:
+                size_t first = hole * D + 1;
+                if (first >= size) {
+                    break;
+                }
+                size_t end = std::min<size_t>(first + D, size);
+                size_t best = first;
+                for (size_t child = first + 1; child < end; child++) {
+                    if (before(*heap[child], *heap[best])) {
+                        best = child;
+                    }
+                }
+
+                if (!before(*heap[best], *last)) {
+                    break;
+                }
+                heap[hole] = heap[best];
+                hole = best;
+
+            }
+            heap[hole] = last;
+            return front;
+
+        }
+
+        /**
+         * Indicates if this queue is empty or not.
+         * @return true if this queue is empty, false otherwise.
+         */
+        bool empty() const {
+            return heap.empty();
+        }
+
+        /**
+         * Retrieves the number of nodes in this queue.
+         * @return The number of nodes.
+         */
+        size_t size() const {
+            return heap.size();
+        }
+
+        /**
+         * Lists the nodes of this queue from front to back, without removing them.
+         * @param nodes : The list receiving the nodes.
+         */
+        void inOrder(std::vector<Node *>& nodes) const {
+            size_t first = nodes.size();
+            nodes.insert(nodes.end(), heap.begin(), heap.end());
+            std::sort(nodes.begin() + first, nodes.end(), [](const Node *node1, const Node *node2) {
+                return Before()(*node1, *node2);
+            });
+        }
+
+};
+
+/**
+ * The PriorityQueue backed by a pairing heap (see PairingHeap).
+ */
+template <typename Node, typename Before>
+class PriorityQueue<Node, Before, PairingHeap> {
+
+    private:
+
+        Node *root; //The node at the front of this queue.
+        size_t count; //The number of nodes in this queue.
+
+        /**
+         * Merges two heaps: the root that comes after the other one becomes its first child.
+         * @param heap1 : The root of the first heap, without siblings.
+         * @param heap2 : The root of the second heap, without siblings.
+         * @return The root of the merged heap.
+         */
+        static Node *meld(Node *heap1, Node *heap2) {
+            if (Before()(*heap2, *heap1)) {
+                std::swap(heap1, heap2);
+            }
+            heap2->queueNext = heap1->queueChild;
+            heap1->queueChild = heap2;
+            return heap1;
+        }
+
+    public:
+
+        /**
+         * Constructs an empty queue.
+         */
+        PriorityQueue() {
+            root = nullptr;
+            count = 0;
+        }
+
+        /**
+         * Adds a node into this queue by merging it with the root.
+         * @param node : The node to be added.
+         */
+        void push(Node *node) {
+            node->queueNext = nullptr;
+            node->queueChild = nullptr;
+            root = root == nullptr ? node : meld(root, node);
+            count++;
+        }
+
+        /**
+         * Retrieves the node at the front of this queue.
+         * @return The node at the front, or nullptr if this queue is empty.
+         */
+        Node *top() const {
+            return root;
+        }
+
+        /**
+         * Removes the node at the front of this queue, which must not be empty. Its children are merged two by two from
+         * left to right, then the pairs are merged from right to left into the new root.
+         * @return The node removed.
+         */
+        Node *pop() {
+
+            Node *front = root;
+            Node *pairs = nullptr; //The merged pairs, the last one first (linked through their hooks)
+
+            //First pass: merges the children two by two:
+            Node *child = front->queueChild;
+            while (child != nullptr) {
+                Node *first = child;
+                Node *second = first->queueNext;
+                if (second == nullptr) {
+                    first->queueNext = pairs;
+                    pairs = first;
+                    break;
+                }
+                child = second->queueNext;
+                first->queueNext = nullptr;
+                second->queueNext = nullptr;
+                Node *pair = meld(first, second);
+                pair->queueNext = pairs;
+                pairs = pair;
+            }
+
+            //Second pass: merges the pairs from the last one to the first one:
+            root = nullptr;
+            while (pairs != nullptr) {
+                Node *pair = pairs;
+                pairs = pair->queueNext;
+                pair->queueNext = nullptr;
+                root = root == nullptr ? pair : meld(root, pair);
+            }
+
+            front->queueChild = nullptr;
+            count--;
+            return front;
+
+        }
+
+        /**
+         * Indicates if this queue is empty or not.
+         * @return true if this queue is empty, false otherwise.
+         */
+        bool empty() const {
+            return root == nullptr;
+        }
+
+        /**
+         * Retrieves the number of nodes in this queue.
+         * @return The number of nodes.
+         */
+        size_t size() const {
+            return count;
+        }
+
+        /**
+         * Lists the nodes of this queue from front to back, without removing them.
+         * @param nodes : The list receiving the nodes.
+         */
+        void inOrder(std::vector<Node *>& nodes) const {
+            size_t first = nodes.size();
+            if (root != nullptr) {
+                nodes.push_back(root);
+            }
+
+            //Every node listed so far brings in its children:
+            for (size_t i = first; i < nodes.size(); i++) {
+                for (Node *child = nodes[i]->queueChild; child != nullptr; child = child->queueNext) {
+                    nodes.push_back(child);
+                }
+            }
+
+            std::sort(nodes.begin() + first, nodes.end(), [](const Node *node1, const Node *node2) {
+                return Before()(*node1, *node2);
+            });
+        }
+
+};
@@ -0,0 +1,58 @@
+/**
+ * This file is the implementation of the ProcessPool.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "ProcessPool.h"
+
+#include <new>
+
+/**
+ * Constructs an empty pool.
+ */
+ProcessPool::ProcessPool() {
+    freeList = nullptr;
+}
+
+/**
+ * Creates the process of a plane in a free block, allocating a new chunk if there are none left.
+ * @param plane : The plane.
+ * @return The new process.
+ */
+PlaneProcess *ProcessPool::create(const Plane& plane) {
+
+    //Threads a new chunk into the free list:
+    if (freeList == nullptr) {
+        Block *chunk = new Block[PROCESS_CHUNK];
+        chunks.push_back(chunk);
+        for (int i = 0; i < PROCESS_CHUNK; i++) {
+            chunk[i].nextFree = (i + 1 < PROCESS_CHUNK) ? &chunk[i + 1] : nullptr;
+        }
+        freeList = chunk;
+    }
+
+    Block *block = freeList;
+    freeList = block->nextFree;
+    return new (block->storage) PlaneProcess(plane);
+
+}
+
+/**
+ * Destroys a process created by this pool and puts its block back into the free list.
+ * @param process : The process.
+ */
+void ProcessPool::destroy(PlaneProcess *process) {
+    process->~PlaneProcess();
+    Block *block = reinterpret_cast<Block *>(process);
+    block->nextFree = freeList;
+    freeList = block;
+}
+
+/**
+ * Deallocates every chunk. Every process must have been destroyed first.
+ */
+ProcessPool::~ProcessPool() {
+    for (size_t i = 0; i < chunks.size(); i++) {
+        delete[] chunks[i];
+    }
+}
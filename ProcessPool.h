@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "PlaneProcess.h"
+
+constexpr auto PROCESS_CHUNK = 1024; //The number of processes allocated at once by a ProcessPool.
+
+/**
+ * Allocates the PlaneProcess objects of a ProcessSimulation in chunks, and recycles the memory of the finished ones
+ * through a free list, so a plane does not cost a call to the general-purpose allocator once the pool has grown to the
+ * number of planes alive at the same time.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class ProcessPool {
+
+    private:
+
+        /**
+         * A block of the pool: either a process, or a link of the free list once the process is destroyed.
+         */
+        union Block {
+            Block *nextFree; //The next free block (only while this block is free)
+            alignas(PlaneProcess) char storage[sizeof(PlaneProcess)]; //The memory of the process
+        };
+
+        std::vector<Block *> chunks; //The chunks allocated so far.
+        Block *freeList; //The first free block (nullptr if none).
+
+    public:
+
+        /**
+         * Constructs an empty pool.
+         */
+        ProcessPool();
+
+        /**
+         * Creates the process of a plane in a free block, allocating a new chunk if there are none left.
+         * @param plane : The plane.
+         * @return The new process.
+         */
+        PlaneProcess *create(const Plane& plane);
+
+        /**
+         * Destroys a process created by this pool and puts its block back into the free list.
+         * @param process : The process.
+         */
+        void destroy(PlaneProcess *process);
+
+        /**
+         * Deallocates every chunk. Every process must have been destroyed first.
+         */
+        ~ProcessPool();
+
+};
@@ -0,0 +1,160 @@
+/**
+ * This file is the implementation of the ProcessSimulation.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "ProcessSimulation.h"
+
+/**
+ * Orders the agenda so that the process resumed first is at the top of the heap. The order is the same as the events
+ * in the EventPriorityQueue: time, then landings before takeoffs, then the ATC ID.
+ * @param wakeup1 : first process waiting
+ * @param wakeup2 : second process waiting
+ * @return true if the first process is resumed after the second one.
+ */
+bool ProcessSimulation::LaterWakeup::operator()(const Wakeup& wakeup1, const Wakeup& wakeup2) const {
+    if (wakeup1.time != wakeup2.time) {
+        return wakeup1.time > wakeup2.time;
+    }
+    if (wakeup1.takeoff != wakeup2.takeoff) {
+        return wakeup1.takeoff;
+    }
+    return wakeup1.atcId > wakeup2.atcId;
+}
+
+/**
+ * Orders the processes waiting for a runway the same way as the WaitList (landings first, then request time, then
+ * ATC ID).
+ * @param process1 : first process in line
+ * @param process2 : second process in line
+ * @return true if the first process gets a runway after the second one.
+ */
+bool ProcessSimulation::LowerPriority::operator()(const PlaneProcess *process1, const PlaneProcess *process2) const {
+    const Plane& plane1 = process1->getPlane();
+    const Plane& plane2 = process2->getPlane();
+    if (plane1.isTakeoff() != plane2.isTakeoff()) {
+        return plane1.isTakeoff();
+    }
+    if (plane1.getRequestTime() != plane2.getRequestTime()) {
+        return plane1.getRequestTime() > plane2.getRequestTime();
+    }
+    return plane1.getAtcId() > plane2.getAtcId();
+}
+
+/**
+ * Builds a simulation based on the number of runways.
+ * @param numRunways : The number of runways that this simulation holds.
+ */
+ProcessSimulation::ProcessSimulation(int numRunways) {
+    this->numRunways = numRunways;
+    currentTime = 0;
+    totalWastedTime = 0;
+    planesHandled = 0;
+
+    //Every runway starts free:
+    for (int i = 1; i <= numRunways; i++) {
+        freeRunways.push(i);
+    }
+}
+
+/**
+ * Runs the simulation on the requests of the given source, resuming the process at the top of the agenda until
+ * it is empty.
+ * @param source : The source of the requests, read one at a time.
+ * @return The summary of the simulation.
+ */
+SimulationResult ProcessSimulation::run(RequestSource& source) {
+
+    spawnNext(source);
+
+    while (!agenda.empty()) {
+
+        Wakeup wakeup = agenda.top();
+        agenda.pop();
+        currentTime = wakeup.time;
+
+        //A request brings in the next one, exactly like Simulation::handleRequest reads the source:
+        if (wakeup.process->getPhase() == PlaneProcess::REQUEST) {
+            planesHandled++;
+            spawnNext(source);
+        }
+
+        if (wakeup.process->resume(*this)) {
+            pool.destroy(wakeup.process);
+        }
+
+    }
+
+    SimulationResult result;
+    result.numRunways = numRunways;
+    result.totalWastedMinutes = totalWastedTime;
+    result.planesHandled = planesHandled;
+    result.endTime = currentTime;
+    return result;
+
+}
+
+/**
+ * Reads the next request of the source (if any) and puts its process into the agenda at its request time.
+ * @param source : The source of the requests.
+ */
+void ProcessSimulation::spawnNext(RequestSource& source) {
+    Plane plane; //The plane of the next request
+    if (source.next(plane)) {
+        agenda.push(Wakeup{ plane.getRequestTime(), plane.isTakeoff(), plane.getAtcId(), pool.create(plane) });
+    }
+}
+
+/**
+ * Gives the lowest free runway to a process, or puts it in line if they are all busy.
+ * @param process : The process asking for a runway.
+ * @return true if a runway was given right away, false if the process waits in line.
+ */
+bool ProcessSimulation::acquireRunway(PlaneProcess& process) {
+    if (freeRunways.empty()) {
+        waiting.push(&process);
+        return false;
+    }
+    process.setRunwayID(freeRunways.top());
+    freeRunways.pop();
+    return true;
+}
+
+/**
+ * Suspends a process for the given number of minutes.
+ * @param process : The process.
+ * @param duration : The number of minutes before it is resumed.
+ */
+void ProcessSimulation::hold(PlaneProcess& process, int duration) {
+    const Plane& plane = process.getPlane();
+    agenda.push(Wakeup{ currentTime + duration, plane.isTakeoff(), plane.getAtcId(), &process });
+}
+
+/**
+ * Clears the runway of a process. The next process in line (if any) gets the runway and is resumed right away,
+ * otherwise the runway becomes free.
+ * @param process : The process clearing its runway.
+ */
+void ProcessSimulation::releaseRunway(PlaneProcess& process) {
+
+    if (waiting.empty()) {
+        freeRunways.push(process.getRunwayID());
+        return;
+    }
+
+    //Hands the runway over and adds the time the next plane waited to the total tally:
+    PlaneProcess *next = waiting.top();
+    waiting.pop();
+    next->setRunwayID(process.getRunwayID());
+    totalWastedTime += currentTime - next->getPlane().getRequestTime();
+    next->resume(*this);
+
+}
+
+/**
+ * Returns the total amount of wasted time in minutes that planes spend waiting for free runway.
+ * @return The total amount of minutes wasted.
+ */
+int ProcessSimulation::getTotalWastedMinutes() const {
+    return totalWastedTime;
+}
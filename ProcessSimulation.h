@@ -0,0 +1,111 @@
+#pragma once
+
+#include <functional>
+#include <queue>
+#include <vector>
+
+#include "PlaneProcess.h"
+#include "ProcessPool.h"
+#include "RequestSource.h"
+#include "SimulationResult.h"
+
+/**
+ * An alternative simulation engine where each plane is a PlaneProcess resumed by the simulation, instead of a chain of
+ * RequestEvent, ActionEvent and CompleteEvent objects handled by three handlers. The agenda only holds the processes
+ * waiting for a given time (their request, or the runway being cleared), and the processes waiting for a runway sit in
+ * a line ordered like the WaitList.
+ *
+ * The agenda is ordered the same way as the events in the EventPriorityQueue (time, then landings before takeoffs, then
+ * ATC ID), the lowest free runway is handed over first, and the requests are read one at a time from the source, so
+ * the total wasted time is the same as the one of the Simulation class. Only the summary is printed.
+ *
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class ProcessSimulation {
+
+    private:
+
+        /**
+         * A process waiting in the agenda until the given time.
+         */
+        struct Wakeup {
+            int time; //The time when the process is resumed
+            bool takeoff; //Whether the plane of the process is taking off
+            int atcId; //The ATC ID of the plane of the process
+            PlaneProcess *process; //The process
+        };
+
+        /**
+         * Orders the agenda so that the process resumed first is at the top of the heap.
+         */
+        struct LaterWakeup {
+            bool operator()(const Wakeup& wakeup1, const Wakeup& wakeup2) const;
+        };
+
+        /**
+         * Orders the processes waiting for a runway the same way as the WaitList (landings first, then request time,
+         * then ATC ID).
+         */
+        struct LowerPriority {
+            bool operator()(const PlaneProcess *process1, const PlaneProcess *process2) const;
+        };
+
+        int numRunways; //Number of runways (retrieved from command-line argument)
+        ProcessPool pool; //The memory of the processes
+        std::priority_queue<Wakeup, std::vector<Wakeup>, LaterWakeup> agenda; //The processes waiting for a time
+        std::priority_queue<PlaneProcess *, std::vector<PlaneProcess *>, LowerPriority> waiting; //The line for a runway
+        std::priority_queue<int, std::vector<int>, std::greater<int> > freeRunways; //Free runway IDs, lowest first
+        int currentTime; //The current time to keep track of every process.
+        int totalWastedTime; //The amount of time wasted for planes to wait for clearance.
+        int planesHandled; //The number of requests handled so far.
+
+        /**
+         * Reads the next request of the source (if any) and puts its process into the agenda at its request time.
+         * @param source : The source of the requests.
+         */
+        void spawnNext(RequestSource& source);
+
+    public:
+
+        /**
+         * Builds a simulation based on the number of runways.
+         * @param numRunways : The number of runways that this simulation holds.
+         */
+        ProcessSimulation(int numRunways);
+
+        /**
+         * Runs the simulation on the requests of the given source, resuming the process at the top of the agenda until
+         * it is empty.
+         * @param source : The source of the requests, read one at a time.
+         * @return The summary of the simulation.
+         */
+        SimulationResult run(RequestSource& source);
+
+        /**
+         * Gives the lowest free runway to a process, or puts it in line if they are all busy.
+         * @param process : The process asking for a runway.
+         * @return true if a runway was given right away, false if the process waits in line.
+         */
+        bool acquireRunway(PlaneProcess& process);
+
+        /**
+         * Suspends a process for the given number of minutes.
+         * @param process : The process.
+         * @param duration : The number of minutes before it is resumed.
+         */
+        void hold(PlaneProcess& process, int duration);
+
+        /**
+         * Clears the runway of a process. The next process in line (if any) gets the runway and is resumed right away,
+         * otherwise the runway becomes free.
+         * @param process : The process clearing its runway.
+         */
+        void releaseRunway(PlaneProcess& process);
+
+        /**
+         * Returns the total amount of wasted time in minutes that planes spend waiting for free runway.
+         * @return The total amount of minutes wasted.
+         */
+        int getTotalWastedMinutes() const;
+
+};
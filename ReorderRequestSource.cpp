@@ -0,0 +1,93 @@
+/**
+ * This file is the implementation of the ReorderRequestSource.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "ReorderRequestSource.h"
+
+#include <limits>
+
+/**
+ * Orders the held requests by time, then by arrival order (the ATC ID given by the upstream source).
+ * @param plane1 : first held request
+ * @param plane2 : second held request
+ * @return true if the first request is released after the second one.
+ */
+bool ReorderRequestSource::LaterRequest::operator()(const Plane& plane1, const Plane& plane2) const {
+    if (plane1.getRequestTime() != plane2.getRequestTime()) {
+        return plane1.getRequestTime() > plane2.getRequestTime();
+    }
+    return plane1.getAtcId() > plane2.getAtcId();
+}
+
+/**
+ * Constructs the reorder stage over the given feed.
+ * @param upstream : The out of order feed. This source takes ownership of it.
+ * @param window : The number of minutes that a request can be late by.
+ * @param renumber : Whether the requests are given new ATC IDs in release order (true), or keep their upstream ones.
+ */
+ReorderRequestSource::ReorderRequestSource(RequestSource *upstream, int window, bool renumber) {
+    this->upstream = upstream;
+    this->window = window;
+    this->renumber = renumber;
+    upstreamDone = false;
+    started = false;
+    latestTime = 0;
+    releasedTime = std::numeric_limits<int>::min();
+    nextId = 1;
+}
+
+/**
+ * Releases the earliest request once no earlier request can still arrive.
+ * @param plane : The plane receiving the next request.
+ * @return true if a request was released, false if there are no more requests.
+ */
+bool ReorderRequestSource::next(Plane& plane) {
+
+    Plane arrival; //The request read from the upstream feed
+
+    //Reads until the earliest held request is at least window minutes behind the latest one:
+    while (!upstreamDone && (held.empty() || held.top().getRequestTime() > latestTime - window)) {
+
+        if (!upstream->next(arrival)) {
+            upstreamDone = true;
+            break;
+        }
+
+        //Reports the request if a later one was already released:
+        if (started && arrival.getRequestTime() < releasedTime) {
+            std::cerr << "Request " << arrival << " at time " << arrival.getRequestTime()
+                << " arrived beyond the reorder window" << std::endl;
+        }
+
+        if (!started || arrival.getRequestTime() > latestTime) {
+            latestTime = arrival.getRequestTime();
+        }
+        started = true;
+        held.push(arrival);
+
+    }
+
+    if (held.empty()) {
+        return false;
+    }
+
+    //Releases the earliest request with the next ATC ID (or its own one):
+    const Plane& earliest = held.top();
+    plane = Plane(renumber ? nextId++ : earliest.getAtcId(), earliest.getCallSign(), earliest.getFlightNumber(),
+        earliest.getSize(), earliest.getRequestType(), earliest.getRequestTime());
+    held.pop();
+
+    if (plane.getRequestTime() > releasedTime) {
+        releasedTime = plane.getRequestTime();
+    }
+    return true;
+
+}
+
+/**
+ * Deletes the upstream feed.
+ */
+ReorderRequestSource::~ReorderRequestSource() {
+    delete upstream;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <queue>
+#include <vector>
+
+#include "RequestSource.h"
+
+/**
+ * Puts back in time order the requests of a feed that can be out of order by up to a given number of minutes. The requests
+ * are held in a min-heap (the reorder window) and a request is only released once a request at least window minutes later
+ * has been read, since no earlier request can come after that.
+ *
+ * The ATC IDs are given again in release order, so a feed that is out of order within the window gives the same
+ * simulation as the sorted feed. They can also be kept as given by the upstream feed (which must keep them unique), for
+ * the random numbers keyed on the plane (see StochasticModel) to follow it through the reorder. A request arriving after a later request was already released is beyond the window: it
+ * is reported on the error stream and released right away.
+ *
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class ReorderRequestSource : public RequestSource {
+
+    private:
+
+        /**
+         * Orders the held requests by time, then by arrival order (the ATC ID given by the upstream source).
+         */
+        struct LaterRequest {
+            bool operator()(const Plane& plane1, const Plane& plane2) const;
+        };
+
+        RequestSource *upstream; //The out of order feed (owned by this source).
+        int window; //The number of minutes that a request can be late by.
+        std::priority_queue<Plane, std::vector<Plane>, LaterRequest> held; //The requests not released yet.
+        bool upstreamDone; //Whether the upstream feed has no more requests.
+        bool started; //Whether a request has been read yet.
+        int latestTime; //The latest request time read so far.
+        int releasedTime; //The time of the last request released (the lowest int before the first one).
+        int nextId; //The ATC ID of the next request released.
+        bool renumber; //Whether the requests are given new ATC IDs in release order.
+
+    public:
+
+        /**
+         * Constructs the reorder stage over the given feed.
+         * @param upstream : The out of order feed. This source takes ownership of it.
+         * @param window : The number of minutes that a request can be late by.
+         * @param renumber : Whether the requests are given new ATC IDs in release order (true), or keep their upstream ones.
+         */
+        ReorderRequestSource(RequestSource *upstream, int window, bool renumber = true);
+
+        /**
+         * Releases the earliest request once no earlier request can still arrive.
+         * @param plane : The plane receiving the next request.
+         * @return true if a request was released, false if there are no more requests.
+         */
+        bool next(Plane& plane) override;
+
+        /**
+         * Deletes the upstream feed.
+         */
+        ~ReorderRequestSource() override;
+
+};
@@ -23,7 +23,7 @@ RequestLandingEvent::RequestLandingEvent(const RequestLandingEvent& requestLandi
  * Prints the event information onto the console. The following information is displayed for this event:
  * TIME: [time] -> [plane] inbound for landing.
  */
-void RequestLandingEvent::processEvent() {
+void RequestLandingEvent::processEvent() const {
 	std::cout << "TIME: " << this->startTime << " -> " << this->plane << " inbound for landing" << std::endl;
 }
 
@@ -29,7 +29,7 @@ class RequestLandingEvent : public RequestEvent {
          * Prints the event information onto the console. The following information is displayed for this event:
          * TIME: [time] -> [plane] inbound for landing.
          */
-        void processEvent() override;
+        void processEvent() const override;
 
         /**
          * Deallocates this event after it was done.
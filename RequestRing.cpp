@@ -0,0 +1,67 @@
+/**
+ * This file is the implementation of the RequestRing.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "RequestRing.h"
+
+/**
+ * Constructs an empty ring. The capacity is rounded up to the next power of two.
+ * @param capacity : The number of planes that this ring can hold.
+ */
+RequestRing::RequestRing(size_t capacity) : head(0), tail(0) {
+    size_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    slots = new Plane[size];
+    mask = size - 1;
+}
+
+/**
+ * Adds a plane at the back of this ring. Must only be called by the producer thread.
+ * @param plane : The plane to be added.
+ * @return true if the plane was added, false if the ring is full.
+ */
+bool RequestRing::push(const Plane& plane) {
+
+    size_t back = tail.load(std::memory_order_relaxed);
+
+    //The ring is full when the consumer is a whole lap behind:
+    if (back - head.load(std::memory_order_acquire) > mask) {
+        return false;
+    }
+
+    //Fills the slot first, then publishes it to the consumer:
+    slots[back & mask] = plane;
+    tail.store(back + 1, std::memory_order_release);
+    return true;
+
+}
+
+/**
+ * Removes the plane at the front of this ring. Must only be called by the consumer thread.
+ * @param plane : The plane receiving the front of this ring.
+ * @return true if a plane was removed, false if the ring is empty.
+ */
+bool RequestRing::pop(Plane& plane) {
+
+    size_t front = head.load(std::memory_order_relaxed);
+
+    if (front == tail.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    //Copies the slot first, then gives it back to the producer:
+    plane = slots[front & mask];
+    head.store(front + 1, std::memory_order_release);
+    return true;
+
+}
+
+/**
+ * Deallocates the storage of this ring.
+ */
+RequestRing::~RequestRing() {
+    delete[] slots;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include "Plane.h"
+
+/**
+ * A bounded lock-free ring of planes shared by exactly one producer thread and one consumer thread. The producer only
+ * moves the tail and the consumer only moves the head, so neither of them ever waits for a lock.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class RequestRing {
+
+    private:
+
+        Plane *slots; //The storage of this ring.
+        size_t mask; //The capacity minus one (the capacity is a power of two).
+        std::atomic<size_t> head; //The number of planes popped so far (consumer side).
+        char padding[64]; //Keeps head and tail on different cache lines so both threads do not fight over the same line.
+        std::atomic<size_t> tail; //The number of planes pushed so far (producer side).
+
+    public:
+
+        /**
+         * Constructs an empty ring. The capacity is rounded up to the next power of two.
+         * @param capacity : The number of planes that this ring can hold.
+         */
+        RequestRing(size_t capacity);
+
+        /**
+         * Adds a plane at the back of this ring. Must only be called by the producer thread.
+         * @param plane : The plane to be added.
+         * @return true if the plane was added, false if the ring is full.
+         */
+        bool push(const Plane& plane);
+
+        /**
+         * Removes the plane at the front of this ring. Must only be called by the consumer thread.
+         * @param plane : The plane receiving the front of this ring.
+         * @return true if a plane was removed, false if the ring is empty.
+         */
+        bool pop(Plane& plane);
+
+        /**
+         * Deallocates the storage of this ring.
+         */
+        ~RequestRing();
+
+};
@@ -0,0 +1,60 @@
+/**
+ * This file is the implementation of the RequestSource.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "RequestSource.h"
+
+#include <limits>
+#include <stdexcept>
+
+/**
+ * Waits until next() can return without blocking, until new requests come in or until the given wall time. Only
+ * live sources (see MultiFeedRequestSource) ever have to wait for their requests; the others are always ready,
+ * which is the default.
+ * @param deadline : The wall time after which the caller stops waiting (a time already passed only checks).
+ * @return true if next() returns without blocking, false otherwise.
+ */
+bool RequestSource::waitReady(std::chrono::steady_clock::time_point) {
+    return true;
+}
+
+/**
+ * Retrieves the time before which this source has no more requests: the next request it returns is made at or
+ * after it. A source that is always ready never needs it, so the default is the lowest int.
+ * @return The watermark of this source.
+ */
+int RequestSource::getWatermark() {
+    return std::numeric_limits<int>::min();
+}
+
+/**
+ * Retrieves the time of the earliest request that this source already has but cannot give yet.
+ * @return The time of that request, or INT_MAX if there is none (the default).
+ */
+int RequestSource::getHeldTime() {
+    return std::numeric_limits<int>::max();
+}
+
+/**
+ * Tells a live source that the wall clock of a paced simulation (see PacedObserver) has reached the given time:
+ * the requests made at or before it that have not come in yet are late, so they no longer hold the others back.
+ * Does nothing by default.
+ * @param time : The simulated time reached by the wall clock.
+ */
+void RequestSource::passTime(int) {}
+
+/**
+ * Creates an independent copy of this source, positioned at the same request. Both sources then return the same
+ * requests with the same ATC IDs. Used to fork a simulation (see Simulation::Simulation(const Simulation&)).
+ * Sources that cannot be copied throw a std::logic_error, which is the default.
+ * @return The heap-allocated copy, owned by the caller.
+ */
+RequestSource *RequestSource::fork() const {
+    throw std::logic_error("This request source cannot be forked");
+}
+
+/**
+ * Destructor for the source. All subclasses must override this method
+ */
+RequestSource::~RequestSource() {}
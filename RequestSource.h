@@ -0,0 +1,67 @@
+#pragma once
+
+#include <chrono>
+
+#include "Plane.h"
+
+/**
+ * The base abstract class for every source of plane requests used by the simulation. The requests are pulled one at a time,
+ * only when the simulation is ready to handle the next one. Each source assigns the ATC IDs in the order the requests
+ * come out of it.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class RequestSource {
+
+    public:
+
+        /**
+         * Retrieves the next request of this source.
+         * @param plane : The plane receiving the next request.
+         * @return true if a request was retrieved, false if there are no more requests.
+         */
+        virtual bool next(Plane& plane) = 0;
+
+        /**
+         * Waits until next() can return without blocking, until new requests come in or until the given wall time. Only
+         * live sources (see MultiFeedRequestSource) ever have to wait for their requests; the others are always ready,
+         * which is the default.
+         * @param deadline : The wall time after which the caller stops waiting (a time already passed only checks).
+         * @return true if next() returns without blocking, false otherwise.
+         */
+        virtual bool waitReady(std::chrono::steady_clock::time_point deadline);
+
+        /**
+         * Retrieves the time before which this source has no more requests: the next request it returns is made at or
+         * after it. A source that is always ready never needs it, so the default is the lowest int.
+         * @return The watermark of this source.
+         */
+        virtual int getWatermark();
+
+        /**
+         * Retrieves the time of the earliest request that this source already has but cannot give yet.
+         * @return The time of that request, or INT_MAX if there is none (the default).
+         */
+        virtual int getHeldTime();
+
+        /**
+         * Tells a live source that the wall clock of a paced simulation (see PacedObserver) has reached the given time:
+         * the requests made at or before it that have not come in yet are late, so they no longer hold the others back.
+         * Does nothing by default.
+         * @param time : The simulated time reached by the wall clock.
+         */
+        virtual void passTime(int time);
+
+        /**
+         * Creates an independent copy of this source, positioned at the same request. Both sources then return the same
+         * requests with the same ATC IDs. Used to fork a simulation (see Simulation::Simulation(const Simulation&)).
+         * Sources that cannot be copied throw a std::logic_error, which is the default.
+         * @return The heap-allocated copy, owned by the caller.
+         */
+        virtual RequestSource *fork() const;
+
+        /**
+         * Destructor for the source. All subclasses must override this method
+         */
+        virtual ~RequestSource() = 0;
+
+};
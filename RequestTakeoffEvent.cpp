@@ -23,7 +23,7 @@ RequestTakeoffEvent::RequestTakeoffEvent(const RequestTakeoffEvent& requestTakeo
  * Prints the event information onto the console. The following information is displayed for this event:
  * TIME: [time] -> [plane] ready for takeoff.
  */
-void RequestTakeoffEvent::processEvent() {
+void RequestTakeoffEvent::processEvent() const {
 	std::cout << "TIME: " << this->startTime << " -> " << this->plane << " ready for takeoff" << std::endl;
 }
 
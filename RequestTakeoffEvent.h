@@ -29,7 +29,7 @@ class RequestTakeoffEvent : public RequestEvent {
          * Prints the event information onto the console. The following information is displayed for this event:
          * TIME: [time] -> [plane] ready for takeoff.
          */
-        void processEvent() override;
+        void processEvent() const override;
 
         /**
          * Deallocates this event after it was done.
@@ -5,11 +5,13 @@
 
 #include "Runway.h"
 
+#include "BinaryIO.h"
+
 /**
  * Constructs the runway based on the input ID.
  * @param id : The id associated with this runway.
  */
-Runway::Runway(int id) : available(true) {
+Runway::Runway(int id) : available(true), closed(false), freeAt(0) {
 	this->id = id;
 }
 
@@ -22,11 +24,11 @@ int Runway::getId() const {
 }
 
 /**
- * Checks if this runway is available or not.
+ * Checks if this runway is available or not. A closed runway is never available.
  * @return A boolean value indicating this runway's availablity.
  */
 bool Runway::isRunwayAvailable() const {
-	return this->available;
+	return this->available && !this->closed;
 }
 
 /**
@@ -43,6 +45,57 @@ void Runway::clearRunway() {
 	this->available = true;
 }
 
+/**
+ * Closes this runway: the plane on it (if any) still clears it, but no other plane is assigned to it afterwards.
+ */
+void Runway::close() {
+	this->closed = true;
+}
+
+/**
+ * Checks if this runway is closed or not.
+ * @return true if the runway has been closed.
+ */
+bool Runway::isClosed() const {
+	return this->closed;
+}
+
+/**
+ * Returns the time when the plane currently on this runway clears it.
+ * @return The time when this runway becomes free again.
+ */
+int Runway::getFreeAt() const {
+	return this->freeAt;
+}
+
+/**
+ * Records the time when the plane currently on this runway clears it.
+ * @param time : The time when this runway becomes free again.
+ */
+void Runway::setFreeAt(int time) {
+	this->freeAt = time;
+}
+
+/**
+ * Writes the state of this runway in binary form (see BinaryIO).
+ * @param out : The binary output stream.
+ */
+void Runway::write(std::ostream& out) const {
+	BinaryIO::writeBool(out, available);
+	BinaryIO::writeBool(out, closed);
+	BinaryIO::writeInt(out, freeAt);
+}
+
+/**
+ * Reads the state written by Runway::write(std::ostream&) into this runway.
+ * @param in : The binary input stream.
+ */
+void Runway::read(std::istream& in) {
+	this->available = BinaryIO::readBool(in);
+	this->closed = BinaryIO::readBool(in);
+	this->freeAt = BinaryIO::readInt(in);
+}
+
 /**
  * Frees this runway back to the memory.
  */
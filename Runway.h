@@ -13,6 +13,8 @@ class Runway {
     private:
         int id; //The ID assigned to this runway.
         bool available; //The boolean flag indicating if this runway is available to be used or not.
+        bool closed; //The boolean flag indicating if this runway is closed for good.
+        int freeAt; //The time when the plane on this runway clears it (used by the runway heap engine only).
 
     public:
         
@@ -29,7 +31,7 @@ class Runway {
         int getId() const;
 
         /**
-         * Checks if this runway is available or not.
+         * Checks if this runway is available or not. A closed runway is never available.
          * @return A boolean value indicating this runway's availablity.
          */
         bool isRunwayAvailable() const;
@@ -44,6 +46,37 @@ class Runway {
          */
         void clearRunway();
 
+        /**
+         * Closes this runway: the plane on it (if any) still clears it, but no other plane is assigned to it afterwards.
+         */
+        void close();
+        /**
+         * Checks if this runway is closed or not.
+         * @return true if the runway has been closed.
+         */
+        bool isClosed() const;
+        /**
+         * Returns the time when the plane currently on this runway clears it.
+         * @return The time when this runway becomes free again.
+         */
+        int getFreeAt() const;
+
+        /**
+         * Records the time when the plane currently on this runway clears it.
+         * @param time : The time when this runway becomes free again.
+         */
+        void setFreeAt(int time);
+        /**
+         * Writes the state of this runway in binary form (see BinaryIO).
+         * @param out : The binary output stream.
+         */
+        void write(std::ostream& out) const;
+        /**
+         * Reads the state written by Runway::write(std::ostream&) into this runway.
+         * @param in : The binary input stream.
+         */
+        void read(std::istream& in);
+
         /**
          * Frees this runway back to the memory.
          */
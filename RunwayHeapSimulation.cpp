@@ -0,0 +1,166 @@
+/**
+ * This file is the implementation of the RunwayHeapSimulation.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "RunwayHeapSimulation.h"
+
+#include "LandingEvent.h"
+
+/**
+ * Orders the busy runways so that the one cleared first is at the top of the heap. The order is the same as the
+ * CompleteEvents in the EventPriorityQueue: clearance time, then landings before takeoffs, then the ATC ID.
+ * @param runway1 : first busy runway
+ * @param runway2 : second busy runway
+ * @return true if the first runway is cleared after the second one.
+ */
+bool RunwayHeapSimulation::LaterClearance::operator()(const BusyRunway& runway1, const BusyRunway& runway2) const {
+    if (runway1.freeAt != runway2.freeAt) {
+        return runway1.freeAt > runway2.freeAt;
+    }
+    if (runway1.takeoff != runway2.takeoff) {
+        return runway1.takeoff;
+    }
+    return runway1.atcId > runway2.atcId;
+}
+
+/**
+ * Builds a simulation based on the number of runways.
+ * @param numRunways : The number of runways that this simulation holds.
+ */
+RunwayHeapSimulation::RunwayHeapSimulation(int numRunways) {
+    this->numRunways = numRunways;
+    this->runways = new Runways(numRunways);
+    this->waitList = new WaitList;
+    currentTime = 0;
+    totalWastedTime = 0;
+
+    //Every runway starts free:
+    for (int i = 1; i <= numRunways; i++) {
+        freeRunways.push(i);
+    }
+}
+
+/**
+ * Destroys and frees any resources associating with this simulation: the waitlist and the runways object.
+ */
+RunwayHeapSimulation::~RunwayHeapSimulation() {
+    delete runways;
+    delete waitList;
+}
+
+/**
+ * Starts the simulation by reading the inputFile. The pseudocode for this algorithm is:
+ *
+ *  While there is a next request {
+ *      While the earliest busy runway clears before this request {
+ *          Clear it and assign it to the next plane in line (if any)
+ *      }
+ *      Assign a free runway to this plane, or add it to the waiting line
+ *  }
+ *  Clear every busy runway left
+ *
+ * @param fileName : the input file to handle the file reading actions.
+ */
+void RunwayHeapSimulation::startSimulation(const std::string& fileName) {
+
+    std::ifstream inputFile(fileName); //The input file stream associating with this simulation
+    std::string line; //The line read from the file
+    int id = 1; //The ID for each plane created
+
+    //Handles each request in the order of the file:
+    while (std::getline(inputFile, line)) {
+
+        Plane plane = Plane::parse(line, id++);
+
+        //Clears every runway that becomes free before this request:
+        while (clearsBefore(plane)) {
+            release();
+        }
+
+        currentTime = plane.getRequestTime();
+
+        //Assigns the lowest free runway if there is one, otherwise the plane waits in line:
+        if (!freeRunways.empty()) {
+            int runwayID = freeRunways.top();
+            freeRunways.pop();
+            occupy(runways->getRunway(runwayID), plane);
+        } else {
+            waitList->enqueue(plane);
+        }
+
+    }
+
+    //No more requests, clears the remaining busy runways:
+    while (!busyRunways.empty()) {
+        release();
+    }
+
+}
+
+/**
+ * Checks if the busy runway at the top of the heap is cleared before the given request is handled.
+ * @param plane : The plane making the next request.
+ * @return true if the earliest runway clears before this request.
+ */
+bool RunwayHeapSimulation::clearsBefore(const Plane& plane) const {
+
+    if (busyRunways.empty()) {
+        return false;
+    }
+
+    //Compares in the same order as the EventPriorityQueue does:
+    const BusyRunway& earliest = busyRunways.top();
+    if (earliest.freeAt != plane.getRequestTime()) {
+        return earliest.freeAt < plane.getRequestTime();
+    }
+    if (earliest.takeoff != plane.isTakeoff()) {
+        return !earliest.takeoff;
+    }
+    return earliest.atcId < plane.getAtcId();
+
+}
+
+/**
+ * Assigns the plane to the given runway at the current time and puts the runway into the busy heap.
+ * @param runway : The runway to be assigned.
+ * @param plane : The plane that has been cleared.
+ */
+void RunwayHeapSimulation::occupy(Runway *runway, const Plane& plane) {
+    runway->assignPlane();
+    runway->setFreeAt(currentTime + plane.getServiceTime());
+    busyRunways.push(BusyRunway{ runway->getFreeAt(), plane.isTakeoff(), plane.getAtcId(), runway });
+}
+
+/**
+ * Clears the runway at the top of the busy heap. If the wait list is not empty, the next plane is assigned to this
+ * runway right away, otherwise the runway goes back to the free runways.
+ */
+void RunwayHeapSimulation::release() {
+
+    Runway *runway = busyRunways.top().runway;
+    busyRunways.pop();
+
+    //Moves the clock to the clearance time and frees the runway:
+    currentTime = runway->getFreeAt();
+    runway->clearRunway();
+
+    if (waitList->isEmpty()) {
+        freeRunways.push(runway->getId());
+        return;
+    }
+
+    //Assigns the next plane in line and adds the time it waited to the total tally:
+    Plane currentPlane = waitList->dequeue();
+    totalWastedTime += currentTime - currentPlane.getRequestTime();
+    occupy(runway, currentPlane);
+
+}
+
+/**
+ * Returns the total amount of wasted time in minutes that planes spend waiting for free runway.
+ * @return The total amount of minutes wasted.
+ */
+int RunwayHeapSimulation::getTotalWastedMinutes() {
+    return totalWastedTime;
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <fstream>
+#include <functional>
+#include <queue>
+#include <vector>
+
+#include "Runways.h"
+#include "WaitList.h"
+
+/**
+ * An alternative simulation engine that only keeps the requests as events. Instead of a CompleteEvent for every plane,
+ * each busy runway remembers the time when it is cleared (Runway::getFreeAt()) and sits in a min-heap. The wait list is
+ * drained every time the earliest runway clears before the next request.
+ *
+ * The busy runways are ordered the same way as the CompleteEvents would have been in the EventPriorityQueue (clearance time,
+ * then landings before takeoffs, then ATC ID of the plane on the runway), so the total wasted time is the same as the
+ * one of the Simulation class. The free runways are kept in a min-heap of IDs so the lowest ID is always assigned first.
+ *
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class RunwayHeapSimulation {
+
+    private:
+
+        /**
+         * A busy runway inside the heap. The plane's request type and ATC ID are kept to break ties in clearance time.
+         */
+        struct BusyRunway {
+            int freeAt; //The time when this runway is cleared.
+            bool takeoff; //Whether the plane on this runway is taking off.
+            int atcId; //The ATC ID of the plane on this runway.
+            Runway *runway; //The runway itself.
+        };
+
+        /**
+         * Orders the busy runways so that the one cleared first is at the top of the heap.
+         */
+        struct LaterClearance {
+            bool operator()(const BusyRunway& runway1, const BusyRunway& runway2) const;
+        };
+
+        int numRunways; //Number of runways (retrieved from command-line argument)
+        Runways *runways; //The runway manager (storing runways and perform runway-related operations)
+        WaitList *waitList; //The wait list to assign each plane into position to either takeoff or land.
+        std::priority_queue<BusyRunway, std::vector<BusyRunway>, LaterClearance> busyRunways; //Busy runways by clearance time
+        std::priority_queue<int, std::vector<int>, std::greater<int> > freeRunways; //Free runway IDs, lowest first
+        int currentTime; //The current time to keep track of every event.
+        int totalWastedTime; //The amount of time wasted for planes to wait for clearance.
+
+        /**
+         * Assigns the plane to the given runway at the current time and puts the runway into the busy heap.
+         * @param runway : The runway to be assigned.
+         * @param plane : The plane that has been cleared.
+         */
+        void occupy(Runway *runway, const Plane& plane);
+
+        /**
+         * Clears the runway at the top of the busy heap. If the wait list is not empty, the next plane is assigned to this
+         * runway right away, otherwise the runway goes back to the free runways.
+         */
+        void release();
+
+        /**
+         * Checks if the busy runway at the top of the heap is cleared before the given request is handled.
+         * @param plane : The plane making the next request.
+         * @return true if the earliest runway clears before this request.
+         */
+        bool clearsBefore(const Plane& plane) const;
+
+    public:
+
+        /**
+         * Builds a simulation based on the number of runways.
+         * @param numRunways : The number of runways that this simulation holds.
+         */
+        RunwayHeapSimulation(int numRunways);
+
+        /**
+         * Starts the simulation by reading the inputFile. The pseudocode for this algorithm is:
+         *
+         *  While there is a next request {
+         *      While the earliest busy runway clears before this request {
+         *          Clear it and assign it to the next plane in line (if any)
+         *      }
+         *      Assign a free runway to this plane, or add it to the waiting line
+         *  }
+         *  Clear every busy runway left
+         *
+         * @param fileName : the input file to handle the file reading actions.
+         */
+        void startSimulation(const std::string& fileName);
+
+        /**
+         * Returns the total amount of wasted time in minutes that planes spend waiting for free runway.
+         * @return The total amount of minutes wasted.
+         */
+        int getTotalWastedMinutes();
+
+        /**
+         * Destroys and frees any resources associating with this simulation: the waitlist and the runways object.
+         */
+        ~RunwayHeapSimulation();
+
+};
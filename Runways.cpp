@@ -5,6 +5,10 @@
 
 #include "Runways.h"
 
+#include <stdexcept>
+
+#include "BinaryIO.h"
+
 /**
  * Fills the runways array with the heap-allocated runway objects. 
  * Each runway is assigned an ID from 1 to numberOfRunways.
@@ -25,9 +29,25 @@ void Runways::fill() {
 Runways::Runways(int numberOfRunways) {
     this->numberOfRunways = numberOfRunways;
     runways = new Runway*[numberOfRunways];
+    nextFree = 0;
     this->fill();
 }
 
+/**
+ * Constructs a deep copy of the input list. Every runway is copied with its current state.
+ * @param other : The runway list to be copied.
+ */
+Runways::Runways(const Runways& other) {
+    this->numberOfRunways = other.numberOfRunways;
+    runways = new Runway*[numberOfRunways];
+    nextFree = other.nextFree;
+
+    //For loop to copy every runway:
+    for (int i = 0; i < numberOfRunways; ++i) {
+        runways[i] = new Runway(*other.runways[i]);
+    }
+}
+
 /**
  * Retrieves a Runway based on the input ID.
  * @param id : The id of the runway to look for.
@@ -38,18 +58,61 @@ Runway *Runways::getRunway(int id){
 }
 
 /**
- * Performs a linear search and retrieves the first runway in this list that is available to be used.
+ * Performs a linear search and retrieves the first runway in this list that is available to be used. The search
+ * resumes where the previous one stopped, so consecutive calls only go over the list once until a runway is cleared.
  * @return The nearest runway that is not occupied by any planes.
  */
 Runway *Runways::getUnoccupied() {
-    for (int i = 0; i < numberOfRunways; i++) {
-        if (runways[i]->isRunwayAvailable()) {
-            return runways[i];
+    for (; nextFree < numberOfRunways; nextFree++) {
+        if (runways[nextFree]->isRunwayAvailable()) {
+            return runways[nextFree];
         }
     }
     return nullptr;
 }
 
+/**
+ * Clears the runway with the input ID and makes it available to use again.
+ * @param id : The id of the runway to be cleared.
+ * @return The runway object with this ID.
+ */
+Runway *Runways::clearRunway(int id) {
+
+    //The next search must start from this runway if it comes before the current starting point:
+    if (id - 1 < nextFree) {
+        nextFree = id - 1;
+    }
+
+    runways[id - 1]->clearRunway();
+    return runways[id - 1];
+}
+
+/**
+ * Writes the state of every runway in binary form (see Runway::write(std::ostream&)).
+ * @param out : The binary output stream.
+ */
+void Runways::write(std::ostream& out) const {
+    BinaryIO::writeInt(out, numberOfRunways);
+    BinaryIO::writeInt(out, nextFree);
+    for (int i = 0; i < numberOfRunways; i++) {
+        runways[i]->write(out);
+    }
+}
+
+/**
+ * Reads the state written by Runways::write(std::ostream&) into these runways. The number of runways must be the same.
+ * @param in : The binary input stream.
+ */
+void Runways::read(std::istream& in) {
+    if (BinaryIO::readInt(in) != numberOfRunways) {
+        throw std::runtime_error("The number of runways does not match");
+    }
+    nextFree = BinaryIO::readInt(in);
+    for (int i = 0; i < numberOfRunways; i++) {
+        runways[i]->read(in);
+    }
+}
+
 /**
  * Destructor for this list. It first traverses the array to delete any allocated Runway objects, 
  * then deletes the array itself.
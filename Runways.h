@@ -13,6 +13,7 @@ class Runways {
 	
 		int numberOfRunways; //The number of runways that the airport has.
 		Runway **runways; //The list that contains heap-allocated runway objects. 
+		int nextFree; //The index where the next search for a free runway starts (every runway before it is occupied).
 
 		/**
 		 * Fills the runways array with the heap-allocated runway objects. 
@@ -27,6 +28,11 @@ class Runways {
 		 * @param numberOfRunways : The number of runways that this list can hold.
 		 */
 		Runways(int numberOfRunways);
+		/**
+		 * Constructs a deep copy of the input list. Every runway is copied with its current state.
+		 * @param other : The runway list to be copied.
+		 */
+		Runways(const Runways& other);
 
 		/**
 		 * Retrieves a Runway based on the input ID.
@@ -36,11 +42,29 @@ class Runways {
 		Runway *getRunway(int id);
 
 		/**
-		 * Performs a linear search and retrieves the first runway in this list that is available to be used.
+		 * Performs a linear search and retrieves the first runway in this list that is available to be used. The search
+		 * resumes where the previous one stopped, so consecutive calls only go over the list once until a runway is cleared.
 		 * @return The nearest runway that is not occupied by any planes.
 		 */
 		Runway *getUnoccupied();
 
+		/**
+		 * Clears the runway with the input ID and makes it available to use again.
+		 * @param id : The id of the runway to be cleared.
+		 * @return The runway object with this ID.
+		 */
+		Runway *clearRunway(int id);
+		/**
+		 * Writes the state of every runway in binary form (see Runway::write(std::ostream&)).
+		 * @param out : The binary output stream.
+		 */
+		void write(std::ostream& out) const;
+		/**
+		 * Reads the state written by Runways::write(std::ostream&) into these runways. The number of runways must be the same.
+		 * @param in : The binary input stream.
+		 */
+		void read(std::istream& in);
+
 		/**
 		 * Destructor for this list. It first traverses the array to delete any allocated Runway objects, 
 		 * then deletes the array itself.
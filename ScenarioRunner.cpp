@@ -0,0 +1,102 @@
+/**
+ * This file is the implementation of the ScenarioRunner.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "ScenarioRunner.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include "Simulation.h"
+#include "TraceLoader.h"
+
+/**
+ * Retrieves a trace from the cache, loading it the first time it is used or when its file has changed.
+ * @param fileName : The name of the trace file.
+ * @return The planes of this trace.
+ */
+ScenarioRunner::Trace ScenarioRunner::getTrace(const std::string& fileName) {
+
+    FileStamp stamp = FileStamp::of(fileName); //The current size and modification time of the file
+
+    {
+        std::lock_guard<std::mutex> guard(tracesLock);
+        std::map<std::string, CachedTrace>::iterator found = traces.find(fileName);
+        if (found != traces.end() && found->second.stamp == stamp) {
+            return found->second.planes;
+        }
+    }
+
+    //Loads the trace without holding the lock, so the other scenarios are not blocked meanwhile:
+    if (!std::ifstream(fileName)) {
+        throw std::runtime_error("Cannot open " + fileName);
+    }
+    Trace trace = std::make_shared<const std::vector<Plane> >(TraceLoader::load(fileName));
+
+    //Keeps the first copy if another thread loaded the same version of the trace at the same time. The scenarios still
+    //running on an older version keep it alive through their own pointer:
+    std::lock_guard<std::mutex> guard(tracesLock);
+    CachedTrace& cached = traces[fileName];
+    if (cached.planes == nullptr || cached.stamp != stamp) {
+        cached.stamp = stamp;
+        cached.planes = trace;
+    }
+    return cached.planes;
+
+}
+
+/**
+ * Runs one scenario.
+ * @param scenario : The scenario line.
+ * @return The answer line (without the line break).
+ */
+std::string ScenarioRunner::answer(const std::string& scenario) {
+
+    std::stringstream tokens(scenario); //The tokens of the scenario
+    std::string fileName; //The trace file
+    std::string runways; //The number of runways
+    std::string override; //The current override
+    bool fused = false; //Whether the simulation runs in fused mode
+    long requests = -1; //The number of requests simulated (-1 for all of them)
+
+    try {
+
+        if (!(tokens >> fileName >> runways)) {
+            throw std::invalid_argument("Expected: [traceFile] [runways] [overrides...]");
+        }
+        int numRunways = std::stoi(runways); //The number of runways, as a number
+        if (numRunways < 0) {
+            throw std::invalid_argument("runways must be >= 0");
+        }
+        while (tokens >> override) {
+            if (override.compare(0, 6, "fused=") == 0) {
+                fused = std::stoi(override.substr(6)) != 0;
+            } else if (override.compare(0, 9, "requests=") == 0) {
+                requests = std::stol(override.substr(9));
+            } else {
+                throw std::invalid_argument("Unknown override " + override);
+            }
+        }
+
+        Trace trace = getTrace(fileName);
+        size_t count = (requests < 0) ? trace->size() : std::min<size_t>(requests, trace->size());
+
+        //Runs the simulation silently on the cached planes:
+        Simulation simulation(numRunways);
+        simulation.setObserver(nullptr);
+        simulation.setFusedMode(fused);
+        SimulationResult result = simulation.run(trace->data(), trace->data() + count);
+
+        std::stringstream reply;
+        reply << "OK " << result.numRunways << ' ' << result.totalWastedMinutes << ' ' << result.planesHandled << ' '
+            << result.endTime;
+        return reply.str();
+
+    } catch (const std::exception& error) {
+        return std::string("ERROR ") + error.what();
+    }
+
+}
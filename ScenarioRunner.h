@@ -0,0 +1,62 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "FileStamp.h"
+#include "Plane.h"
+
+/**
+ * Runs simulation scenarios described by one line of text, as sent to the SimulationServer or listed in the manifest of
+ * a BatchExecutor:
+ *
+ *      [traceFile] [runways] [overrides...]
+ *
+ * where the optional overrides are:
+ *      fused=1         runs the simulation in fused mode (see Simulation::setFusedMode)
+ *      requests=N      only simulates the first N requests of the trace
+ *
+ * Each scenario is answered by one line, either "OK [runways] [wastedMinutes] [planesHandled] [endTime]" or
+ * "ERROR [message]". The traces are loaded once and kept in memory, so a scenario only costs the simulation itself. A
+ * trace is loaded again when the size or the modification time of its file has changed.
+ * Any number of threads can run scenarios at the same time.
+ *
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class ScenarioRunner {
+
+    private:
+
+        typedef std::shared_ptr<const std::vector<Plane> > Trace; //A trace loaded in memory, shared by the scenarios using it.
+
+        /**
+         * A trace kept in memory, with the stamp of its file when it was loaded.
+         */
+        struct CachedTrace {
+            FileStamp stamp; //The size and modification time of the file when the trace was loaded.
+            Trace planes; //The planes of the trace.
+        };
+
+        std::map<std::string, CachedTrace> traces; //The traces loaded so far, by file name.
+        std::mutex tracesLock; //Protects the traces.
+
+        /**
+         * Retrieves a trace from the cache, loading it the first time it is used or when its file has changed.
+         * @param fileName : The name of the trace file.
+         * @return The planes of this trace.
+         */
+        Trace getTrace(const std::string& fileName);
+
+    public:
+
+        /**
+         * Runs one scenario.
+         * @param scenario : The scenario line.
+         * @return The answer line (without the line break).
+         */
+        std::string answer(const std::string& scenario);
+
+};
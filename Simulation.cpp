@@ -10,12 +10,22 @@
 #include "TakeoffEvent.h"
 #include "LandingEvent.h"
 #include "CompleteEvent.h"
+#include "FileRequestSource.h"
+#include "PrefetchRequestSource.h"
+#include "MemoryRequestSource.h"
+#include "TraceLoader.h"
+#include "ReorderRequestSource.h"
+#include "CheckpointWriter.h"
+#include "BinaryIO.h"
+#include "TraceIndex.h"
+#include "WindowRequestSource.h"
+#include "MultiFeedRequestSource.h"
+
+#include <algorithm>
+#include <limits>
 
 constexpr auto TAGS_DECORATED = 20; //Uses in summary printing only;
 
-
-static int id = 1; //The ID for each plane created
-
 /**
  * Helper method which destroys the allocated event and assigns it to nullptr. This is a part of the cleanup code.
  * 
@@ -37,6 +47,304 @@ Simulation::Simulation(int numRunways) {
     this->waitList = new WaitList;
     currentTime = 0;
     totalWastedTime = 0;
+    fused = false;
+    prefetch = false;
+    loadThreads = -1;
+    reorderWindow = -1;
+    observer = &console;
+    pacer = nullptr;
+    requestWanted = false;
+    passedTime = std::numeric_limits<int>::min();
+    planesHandled = 0;
+    started = false;
+    checkpointInterval = 0;
+    resume = false;
+    inputEnded = false;
+    pauseAtEndOfInput = false;
+    windowed = false;
+    windowStart = 0;
+    windowEnd = 0;
+    warmup = 0;
+    measureFrom = std::numeric_limits<int>::min();
+    model = nullptr;
+    replica = 0;
+}
+
+/**
+ * Forks the given simulation: constructs an independent copy of its whole state (runways, event queue, wait list,
+ * pending actions, options and counters) so that both can continue on their own, even on different threads. The
+ * copy keeps notifying the same observer, except the default console observer which is its own. The input position
+ * is not part of the simulation, so the copy must be continued on a copy of the source (see RequestSource::fork()).
+ * @param other : The simulation to be forked, usually stopped by Simulation::runUntil(RequestSource&, int).
+ */
+Simulation::Simulation(const Simulation& other) {
+    this->numRunways = other.numRunways;
+    this->runways = new Runways(*other.runways);
+    this->eventQueue = new EventPriorityQueue(*other.eventQueue);
+    this->waitList = new WaitList(*other.waitList);
+    this->pendingActions = other.pendingActions;
+    currentTime = other.currentTime;
+    totalWastedTime = other.totalWastedTime;
+    fused = other.fused;
+    prefetch = other.prefetch;
+    loadThreads = other.loadThreads;
+    reorderWindow = other.reorderWindow;
+    feeds = other.feeds;
+    observer = (other.observer == &other.console) ? &console : other.observer;
+    pacer = other.pacer;
+    requestWanted = other.requestWanted;
+    passedTime = other.passedTime;
+    planesHandled = other.planesHandled;
+    started = other.started;
+    checkpointFile = other.checkpointFile;
+    checkpointInterval = other.checkpointInterval;
+    resume = other.resume;
+    inputEnded = other.inputEnded;
+    pauseAtEndOfInput = other.pauseAtEndOfInput;
+    incrementalFile = other.incrementalFile;
+    windowed = other.windowed;
+    windowStart = other.windowStart;
+    windowEnd = other.windowEnd;
+    warmup = other.warmup;
+    measureFrom = other.measureFrom;
+    model = other.model;
+    replica = other.replica;
+}
+
+/**
+ * Sets the observer receiving every event handled by this simulation. By default, the events are printed onto the
+ * console by a ConsoleObserver.
+ * @param observer : The observer to be notified (not owned by this simulation), or nullptr to run silently.
+ */
+void Simulation::setObserver(SimulationObserver *observer) {
+    this->observer = observer;
+}
+
+/**
+ * Sets the wall clock of a paced simulation, usually the observer as well (see setObserver). A live source (see
+ * MultiFeedRequestSource) is then only waited for until the next event is due, so that a quiet feed does not
+ * hold back the events of the other ones.
+ * @param pacer : The paced observer (not owned by this simulation), or nullptr if not paced.
+ */
+void Simulation::setPacer(PacedObserver *pacer) {
+    this->pacer = pacer;
+}
+
+/**
+ * Runs the whole simulation on the requests stored in memory, without printing anything unless an observer prints it.
+ * The planes are served in order with their own ATC IDs. A simulation object is meant to be run only once.
+ * @param begin : The plane of the first request.
+ * @param end : One past the plane of the last request.
+ * @return The summary of the simulation.
+ */
+SimulationResult Simulation::run(const Plane *begin, const Plane *end) {
+    MemoryRequestSource source(begin, end);
+    return run(source);
+}
+
+/**
+ * Runs the whole simulation on the requests of the given source, without printing anything unless an observer prints it.
+ * A simulation object is meant to be run only once.
+ * @param source : The source of the requests, read one at a time.
+ * @return The summary of the simulation.
+ */
+SimulationResult Simulation::run(RequestSource& source) {
+    startSimulation(source);
+    return getResult();
+}
+
+/**
+ * Makes the simulation write a checkpoint every given number of simulated minutes (see CheckpointWriter). The input
+ * file is then read line by line on the simulation thread, whatever the other options are.
+ * @param fileName : The name of the checkpoint file, or an empty string for no checkpoints.
+ * @param interval : The number of simulated minutes between two checkpoints.
+ */
+void Simulation::setCheckpoint(const std::string& fileName, int interval) {
+    this->checkpointFile = fileName;
+    this->checkpointInterval = interval;
+}
+
+/**
+ * Makes the simulation resume from its checkpoint file (see Simulation::setCheckpoint(const std::string&, int)) if
+ * it exists, instead of starting from the beginning of the input file.
+ * @param resume : true to resume from the latest checkpoint.
+ */
+void Simulation::setResume(bool resume) {
+    this->resume = resume;
+}
+
+/**
+ * Makes the simulation incremental: the state at the end of the input is saved into the given file, and the next run
+ * with the same file restores it and only reads the lines appended to the input file since then. Only the lines
+ * ending with a line break are read.
+ * @param fileName : The name of the state file, or an empty string to run the whole input file.
+ */
+void Simulation::setIncremental(const std::string& fileName) {
+    this->incrementalFile = fileName;
+}
+
+/**
+ * Makes the simulation only read the requests of the input file made within the given time window, starting a
+ * warm-up period before the window so that the wait list and the runways are already busy when it starts. The
+ * input file must be sorted by request time: its TraceIndex is used to seek straight to the start of the warm-up
+ * instead of reading the file from the beginning. Only the requests made within the window are counted in the
+ * totals.
+ * @param start : The first request time of the window.
+ * @param end : The end of the window (the requests made at or after it are not read).
+ * @param warmup : The number of minutes simulated before the window (0 for none).
+ */
+void Simulation::setWindow(int start, int end, int warmup) {
+    this->windowed = true;
+    this->windowStart = start;
+    this->windowEnd = end;
+    this->warmup = warmup;
+}
+
+/**
+ * Makes the service times random: each one is drawn by the given model for the given replica instead of being
+ * Plane::getServiceTime(). The request times are left as they are (see JitterRequestSource).
+ * @param model : The model drawing the service times (not owned by this simulation), or nullptr for fixed times.
+ * @param replica : The number of the replica drawn from the model.
+ */
+void Simulation::setStochasticModel(const StochasticModel *model, int replica) {
+    this->model = model;
+    this->replica = replica;
+}
+
+/**
+ * Returns the time that the given plane occupies its runway: Plane::getServiceTime(), or a time drawn around it by
+ * the stochastic model if there is one.
+ * @param plane : The plane taking off or landing.
+ * @return The service time in minutes.
+ */
+int Simulation::serviceTime(const Plane& plane) const {
+    int baseTime = plane.getServiceTime();
+    if (model == nullptr) {
+        return baseTime;
+    }
+    return model->sampleServiceTime(baseTime, replica, plane.getAtcId());
+}
+
+/**
+ * Writes the whole state of the simulation in binary form: the counters, the runways, the event queue, the pending
+ * actions and the wait list. The options and the observer are not written.
+ * @param out : The binary output stream.
+ */
+void Simulation::writeState(std::ostream& out) const {
+    BinaryIO::writeInt(out, currentTime);
+    BinaryIO::writeInt(out, totalWastedTime);
+    BinaryIO::writeInt(out, planesHandled);
+    BinaryIO::writeBool(out, started);
+    BinaryIO::writeBool(out, inputEnded);
+    BinaryIO::writeBool(out, fused);
+    runways->write(out);
+    eventQueue->write(out);
+
+    //The pending takeoffs/landings are written as action events, like the other events:
+    BinaryIO::writeInt(out, pendingActions.size());
+    for (size_t i = 0; i < pendingActions.size(); i++) {
+        const PendingAction& action = pendingActions[i];
+        if (action.plane.isTakeoff()) {
+            TakeoffEvent event(action.time, action.plane, action.runwayID);
+            Event::write(out, &event);
+        } else {
+            LandingEvent event(action.time, action.plane, action.runwayID);
+            Event::write(out, &event);
+        }
+    }
+
+    waitList->write(out);
+}
+
+/**
+ * Reads the state written by Simulation::writeState(std::ostream&) into this simulation, which must be new and have
+ * the same number of runways. The simulation continues from there with the source at the same position.
+ * @param in : The binary input stream.
+ */
+void Simulation::readState(std::istream& in) {
+    currentTime = BinaryIO::readInt(in);
+    totalWastedTime = BinaryIO::readInt(in);
+    planesHandled = BinaryIO::readInt(in);
+    started = BinaryIO::readBool(in);
+    inputEnded = BinaryIO::readBool(in);
+    fused = BinaryIO::readBool(in);
+    runways->read(in);
+    eventQueue->read(in);
+
+    int count = BinaryIO::readInt(in); //The number of pending takeoffs/landings
+    for (int i = 0; i < count; i++) {
+        ActionEvent *event = static_cast<ActionEvent *>(Event::read(in));
+        pendingActions.push_back(PendingAction{ event->getTime(), event->getPlane(), event->getRunwayID() });
+        destroyEvent(event);
+    }
+
+    waitList->read(in);
+}
+
+/**
+ * Closes the runway with the given ID from the current time on. The plane on it (if any) still clears it, but no
+ * other plane is assigned to it afterwards.
+ * @param runwayID : The ID of the runway to be closed.
+ */
+void Simulation::closeRunway(int runwayID) {
+    runways->getRunway(runwayID)->close();
+}
+
+/**
+ * Returns the summary of the simulation so far.
+ * @return The number of runways, the total wasted time, the number of requests handled and the current time.
+ */
+SimulationResult Simulation::getResult() const {
+    SimulationResult result;
+    result.numRunways = numRunways;
+    result.totalWastedMinutes = totalWastedTime;
+    result.planesHandled = planesHandled;
+    result.endTime = currentTime;
+    return result;
+}
+
+/**
+ * Turns the prefetching of requests on or off. When it is on, the input file is read and parsed on a separate reader
+ * thread ahead of the simulation (see PrefetchRequestSource).
+ * @param prefetch : true to read the requests on a reader thread, false to read them on the simulation thread.
+ */
+void Simulation::setPrefetchMode(bool prefetch) {
+    this->prefetch = prefetch;
+}
+
+/**
+ * Turns the fused execution mode on or off. In fused mode, assigning a runway directly schedules the Complete event
+ * instead of going through the event queue once more with a Takeoff/Landing event. The output stays the same.
+ * @param fused : true to enable the fused mode, false to use the normal mode.
+ */
+void Simulation::setFusedMode(bool fused) {
+    this->fused = fused;
+}
+
+/**
+ * Makes the simulation load the whole input file in one pass before starting, parsed in parallel by TraceLoader.
+ * @param numThreads : The number of threads parsing the file (0 uses every core), or -1 to read it line by line.
+ */
+void Simulation::setLoadThreads(int numThreads) {
+    this->loadThreads = numThreads;
+}
+
+/**
+ * Makes the simulation accept an input file whose requests can be out of order by up to the given number of minutes.
+ * The requests are put back in time order by a ReorderRequestSource before being handled.
+ * @param window : The number of minutes that a request can be late by, or -1 if the file is in time order.
+ */
+void Simulation::setReorderWindow(int window) {
+    this->reorderWindow = window;
+}
+
+/**
+ * Makes the simulation merge the input file with other live feeds, each one read on its own thread and pushed into
+ * a MultiFeedRequestSource, which releases the requests of every feed in time order.
+ * @param feeds : The input files of the other feeds, each one sorted by request time (empty for none).
+ */
+void Simulation::setFeeds(const std::vector<std::string>& feeds) {
+    this->feeds = feeds;
 }
 
 /**
@@ -61,8 +369,11 @@ Simulation::~Simulation() {
  *  Open data file
  *  Read the first request event from file and put it in the event queue
  *  While event queue is not empty { 
- *      Remove the first event from the event queue 
- *      Process that event, summarize data
+ *      Remove every event sharing the time of the first event from the event queue 
+ *      For each removed event, in order {
+ *          Process the new events of this time that come before it (if any)
+ *          Process that event, summarize data
+ *      }
  *  }
  *
  * @param inputFile : the input file to handle the file reading actions.
@@ -72,33 +383,302 @@ void Simulation::startSimulation(const std::string& fileName) {
     //Prompts a starting message:
     std::cout << "Starting simulation..." << std::endl;
 
-    std::ifstream inputFile; //The input file stream associating with this simulation
+    //With checkpoints or incremental runs, the file is read line by line so that its position can be saved:
+    if (!checkpointFile.empty()) {
+        runWithCheckpoints(fileName);
+        return;
+    }
+    if (!incrementalFile.empty()) {
+        runIncremental(fileName);
+        return;
+    }
+
+    RequestSource *source; //The source of the requests associating with this simulation
+    std::vector<Plane> planes; //The planes of the whole file (only when it is loaded at once)
+
+    //Either seeks to the window, merges the live feeds, loads the whole file at once, or opens it to be read line by line on
+    //this thread or on a reader thread:
+    if (windowed) {
+        std::streamoff offset; //The position of the first line of the warm-up
+        int nextId; //The ATC ID of the request on that line
+        TraceIndex::open(fileName).seek(windowStart - warmup, offset, nextId);
+        source = new WindowRequestSource(new FileRequestSource(fileName, offset, nextId), windowStart - warmup, windowEnd);
+        measureFrom = windowStart;
+    } else if (!feeds.empty()) {
+        MultiFeedRequestSource *merged = new MultiFeedRequestSource(feeds.size() + 1);
+        merged->readFile(0, fileName);
+        for (size_t i = 0; i < feeds.size(); i++) {
+            merged->readFile(i + 1, feeds[i]);
+        }
+        source = merged;
+    } else if (loadThreads >= 0) {
+        planes = TraceLoader::load(fileName, loadThreads);
+        source = new MemoryRequestSource(planes.data(), planes.data() + planes.size());
+    } else if (prefetch) {
+        source = new PrefetchRequestSource(fileName);
+    } else {
+        source = new FileRequestSource(fileName);
+    }
+
+    //Puts the requests back in time order first if the file can be out of order:
+    if (reorderWindow >= 0) {
+        source = new ReorderRequestSource(source, reorderWindow);
+    }
 
-    //Opens the file based on the file name:
-    inputFile.open(fileName);
+    startSimulation(*source);
+    delete source;
 
-    
-    std::string line; //The line read from the file
-    Event *event; //The event used in creating and keeping track of dequeuings.
+}
+
+/**
+ * Runs the simulation on the input file read line by line, handing a copy of the simulation to a CheckpointWriter
+ * every checkpoint interval in which an event was handled (the intervals without any event are skipped). If resuming,
+ * the state and the input position are restored from the checkpoint first.
+ * @param fileName : The name of the input file.
+ */
+void Simulation::runWithCheckpoints(const std::string& fileName) {
 
-    //If the file contains any lines, proceeds to reads the first line:
-    if (std::getline(inputFile, line)) {
+    std::streamoff offset = 0; //The position of the next line to be read
+    int nextId = 1; //The ATC ID of the request on that line
+
+    if (resume && CheckpointWriter::restore(checkpointFile, *this, offset, nextId)) {
+        std::cout << "Resuming from the checkpoint at time " << currentTime << "..." << std::endl;
+    }
 
-        //Creates the event based on the first line, then puts it into the queue:
-        event = this->createEvent(line);
-        this->eventQueue->enqueue(event);
+    FileRequestSource source(fileName, offset, nextId);
+    CheckpointWriter writer(checkpointFile);
 
-        //While loop to dequeue each event out until the queue is empty. Processes each event as it is being removed:
-        while (!eventQueue->isEmpty()) {
-            
-            //Retrieves the event and updates the current time:
-            event = eventQueue->dequeue();
-            currentTime = event->getTime();
+    int time = currentTime; //The end of the current interval
+    bool running = true; //Whether there are events left
 
-            //Handles this event with the given file stream, then deallocates the event once finished:
-            handleEvent(event, inputFile);
-            destroyEvent(event);
+    //Runs one interval at a time, saving a copy of the state after each of them:
+    while (running) {
 
+        //Skips the intervals without any event at once, so an idle stretch is neither stepped through nor saved again:
+        long long end = (long long) time + checkpointInterval; //The end of the next interval
+        if (started && getNextEventTime() > end) {
+            end += ((long long) getNextEventTime() - end + checkpointInterval - 1) / checkpointInterval * checkpointInterval;
+        }
+        time = (int) std::min<long long>(end, std::numeric_limits<int>::max());
+
+        bool handling = !started || getNextEventTime() <= time; //Whether this interval handles any event
+        running = runUntil(source, time);
+        if (running && handling) {
+            writer.submit(new Simulation(*this), source.getOffset(), source.getNextId());
+        }
+
+    }
+
+}
+
+/**
+ * Runs the simulation on the lines appended to the input file since the previous incremental run. The state saved
+ * by that run is restored first, then the new lines are handled until the end of the input, where the state is
+ * saved again (on a CheckpointWriter thread) before the remaining events are handled.
+ * @param fileName : The name of the input file.
+ */
+void Simulation::runIncremental(const std::string& fileName) {
+
+    std::streamoff offset = 0; //The position of the first line not handled yet
+    int nextId = 1; //The ATC ID of the request on that line
+    bool restored = CheckpointWriter::restore(incrementalFile, *this, offset, nextId);
+
+    //The input file can only grow between two runs:
+    std::ifstream inputFile(fileName, std::ios::binary | std::ios::ate);
+    if (restored && std::streamoff(inputFile.tellg()) < offset) {
+        throw std::runtime_error(fileName + " is shorter than when " + incrementalFile + " was saved");
+    }
+
+    FileRequestSource source(fileName, offset, nextId);
+    source.setCompleteLinesOnly(true);
+
+    //Picks up the new lines where the previous run stopped reading:
+    if (restored) {
+        std::cout << "Resuming from the end of the previous input at time " << currentTime << "..." << std::endl;
+        resumeInput(source);
+    }
+
+    //Handles the requests up to the end of the input, then saves the state while the remaining events are handled:
+    pauseAtEndOfInput = true;
+    runUntil(source, std::numeric_limits<int>::max());
+    pauseAtEndOfInput = false;
+
+    CheckpointWriter writer(incrementalFile);
+    writer.submit(new Simulation(*this), source.getOffset(), source.getNextId());
+    runUntil(source, std::numeric_limits<int>::max());
+
+}
+
+/**
+ * Reads the source once more after the input ended, in case new requests were added since then. The request read
+ * (if any) is put into the event queue, exactly as Simulation::handleRequest(RequestEvent *, RequestSource&)
+ * would have done if it had been there at that time.
+ * @param source : The source of the requests, read one at a time.
+ */
+void Simulation::resumeInput(RequestSource& source) {
+
+    Plane plane; //The plane of the next request
+
+    if (inputEnded && source.next(plane)) {
+        inputEnded = false;
+        this->eventQueue->enqueue(this->createEvent(plane));
+    }
+
+}
+
+/**
+ * Returns the time of the next event to be handled, for example to know how far a simulation stopped by
+ * Simulation::runUntil(RequestSource&, int) has to go next.
+ * @return The time of the first event in the event queue, or INT_MAX if it is empty.
+ */
+int Simulation::getNextEventTime() {
+    return eventQueue->isEmpty() ? std::numeric_limits<int>::max() : eventQueue->peek()->getTime();
+}
+
+/**
+ * Starts the simulation on the requests of the given source. This is the same algorithm as
+ * Simulation::startSimulation(const std::string&) without the starting message. If the simulation was stopped by
+ * Simulation::runUntil(RequestSource&, int), it continues from there.
+ * @param source : The source of the requests, read one at a time.
+ */
+void Simulation::startSimulation(RequestSource& source) {
+    runUntil(source, std::numeric_limits<int>::max());
+}
+
+/**
+ * Runs the simulation on the requests of the given source until every event happening at or before the given time
+ * is handled, then stops so that it can be forked or continued later by another call with the same source.
+ * @param source : The source of the requests, read one at a time.
+ * @param time : The last time to be simulated.
+ * @return true if there are events left after this time, false if the simulation has ended.
+ */
+bool Simulation::runUntil(RequestSource& source, int time) {
+
+    std::vector<Event *> batch; //The events removed together because they happen at the same time.
+
+    //On the first call, if the source contains any requests, proceeds to read the first one and put its event into the queue
+    //(see below):
+    if (!started) {
+        started = true;
+        requestWanted = true;
+    }
+
+    //While loop to dequeue the events out until the queue is empty, the time is reached or the input ends (when pausing
+    //there), one batch of events sharing the same time at once. The next request that could not be read right away (the
+    //first one, or one of a live source) is waited for first, unless the next event comes before it:
+    while (true) {
+
+        if (requestWanted) {
+            awaitRequest(source, getNextEventTime());
+        }
+        if (eventQueue->isEmpty() || eventQueue->peek()->getTime() > time || (pauseAtEndOfInput && inputEnded)) {
+            break;
+        }
+
+        eventQueue->dequeueBatch(batch);
+        size_t next = 0; //The index of the next event of the batch to be handled
+
+        while (next < batch.size() && !(pauseAtEndOfInput && inputEnded)) {
+
+            if (requestWanted) {
+                awaitRequest(source, batch[next]->getTime());
+            }
+
+            //Events of the same time created while handling this batch may come before the next one of the batch:
+            if (!eventQueue->isEmpty() && EventPriorityQueue::precedes(eventQueue->peek(), batch[next])) {
+                dispatchEvent(eventQueue->dequeue(), source);
+            } else {
+                dispatchEvent(batch[next++], source);
+            }
+
+        }
+
+        //When pausing in the middle of a batch, the events left go back into the queue in the same order:
+        for (; next < batch.size(); next++) {
+            eventQueue->enqueue(batch[next]);
+        }
+        batch.clear();
+
+    }
+
+    if (!eventQueue->isEmpty()) {
+        return true;
+    }
+
+    //Prints the remaining pending actions (if any):
+    flushActions(nullptr);
+    return false;
+
+}
+
+/**
+ * Handles one event removed from the event queue: prints any pending action that comes before it, updates the current
+ * time, handles the event and deallocates it once finished.
+ * @param event : The event removed from the event queue.
+ * @param source : The source of the requests, used to read the next request if there is one.
+ */
+void Simulation::dispatchEvent(Event *event, RequestSource& source) {
+    flushActions(event);
+    currentTime = event->getTime();
+    handleEvent(event, source);
+    destroyEvent(event);
+}
+
+/**
+ * Reads the next request of the source and puts its event into the event queue. In a paced simulation, a request
+ * of a live source that comes in after the wall clock has passed its time is handled at the current time.
+ * @param source : The source of the requests.
+ */
+void Simulation::readRequest(RequestSource& source) {
+
+    Plane plane; //The plane making the next request
+
+    requestWanted = false;
+    if (!source.next(plane)) {
+        inputEnded = true;
+        return;
+    }
+
+    if (plane.getRequestTime() <= passedTime && plane.getRequestTime() < currentTime) {
+        plane = Plane(plane.getAtcId(), plane.getCallSign(), plane.getFlightNumber(), plane.getSize(),
+            plane.getRequestType(), currentTime);
+    }
+    this->eventQueue->enqueue(this->createEvent(plane));
+
+}
+
+/**
+ * Waits for the next request of a live source that could not be read right away, unless the next event comes
+ * before it: the source is only waited for while its watermark is not past the time of that event. In a paced
+ * simulation, it is only waited for until that event (or the earliest request held by the source) is due on the
+ * wall clock, then the requests not in by then are late (see RequestSource::passTime(int)).
+ * @param source : The source of the requests.
+ * @param time : The time of the next event, or INT_MAX if there is none.
+ */
+void Simulation::awaitRequest(RequestSource& source, int time) {
+
+    bool eventWaiting = time != std::numeric_limits<int>::max(); //Whether an event can go before the next request
+
+    while (requestWanted) {
+
+        //The next request is made after the next event, which goes first:
+        if (eventWaiting && source.getWatermark() > time) {
+            return;
+        }
+
+        //When paced, the source is only waited for until the next event or the earliest request it holds is due:
+        int dueTime = pacer != nullptr ? std::min(time, source.getHeldTime()) : std::numeric_limits<int>::max();
+        std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+        if (dueTime != std::numeric_limits<int>::max()) {
+            deadline = pacer->getDueTime(dueTime);
+        }
+
+        //Sleeps until the request comes in, another message comes in or that time is due, whichever comes first:
+        if (source.waitReady(deadline)) {
+            readRequest(source);
+        } else if (std::chrono::steady_clock::now() >= deadline) {
+            passedTime = std::max(passedTime, dueTime);
+            source.passTime(dueTime);
         }
 
     }
@@ -117,31 +697,37 @@ void Simulation::startSimulation(const std::string& fileName) {
  * 
  * Based on the subtypes of the events, it is handled separately by the methods described below:
  * 
- *      Simulation::handleRequest(RequestEvent *requestEvent, std::ifstream& fileStream);
+ *      Simulation::handleRequest(RequestEvent *requestEvent, RequestSource& source);
  * 
  *      Simulation::handleAction(ActionEvent *actionEvent);
  * 
  *      Simulation::handleComplete(CompleteEvent *completeEvent);
  *
  * @param event : The event to be handled properly.
- * @param fileStream : The input file stream to be used in reading request if it is not EOF.
+ * @param source : The source of the requests, used to read the next request if there is one.
  */
-void Simulation::handleEvent(Event *event, std::ifstream& fileStream) {
-
-    //Prints the event's information to the console:
-    event->processEvent();
+void Simulation::handleEvent(Event *event, RequestSource& source) {
 
     // Type cast the given events into their specific subclasses:
     RequestEvent *requestEvent = dynamic_cast<RequestEvent *>(event); //Request event downcast
     ActionEvent *actionEvent = dynamic_cast<ActionEvent *>(event); //Action event downcast
     CompleteEvent *completeEvent = dynamic_cast<CompleteEvent *>(event); //Completer event downcast
 
-    // Any of the dynamic cast of the pointer is non-null, proceeds to handle the required event:
+    // Any of the dynamic cast of the pointer is non-null, proceeds to notify the observer then handle the required event:
     if (requestEvent != nullptr) {
-        this->handleRequest(requestEvent, fileStream);
+        if (observer != nullptr) {
+            observer->onRequest(*requestEvent);
+        }
+        this->handleRequest(requestEvent, source);
     } else if (actionEvent != nullptr) {
+        if (observer != nullptr) {
+            observer->onAction(*actionEvent);
+        }
         this->handleAction(actionEvent);
     } else if (completeEvent != nullptr) {
+        if (observer != nullptr) {
+            observer->onComplete(*completeEvent);
+        }
         this->handleComplete(completeEvent);
     } else {
         throw std::exception();
@@ -160,7 +746,7 @@ int Simulation::getTotalWastedMinutes() {
 /**
  * Handles the RequestEvent type. An event is considered to be a request is when the plane first makes one with the ATC for permission
  * on either landing or takeoff.
- * This method also receives the ifstream associating with the input file passed in the beginning. The pseudocode for this algorithm is:
+ * This method also receives the source of the requests passed in the beginning. The pseudocode for this algorithm is:
  * 
  *  Add new plane to waiting line
  *  If one of the runways is available {
@@ -168,21 +754,21 @@ int Simulation::getTotalWastedMinutes() {
  *      create a Takeoff/Landing event 
  *      Insert this in order in the event queue
  *  }
- *  If not EOF {
- *      Read the next request event from the file and insert that in the event queue
+ *  If the source has more requests {
+ *      Read the next request event from the source and insert that in the event queue
  *  } 
  * 
  * @param requestEvent : The request event to be handled.
- * @param fileStream : The input file stream to be used in reading request if it is not EOF.
+ * @param source : The source of the requests, used to read the next request if there is one.
  */
-void Simulation::handleRequest(RequestEvent *requestEvent, std::ifstream& fileStream) {
+void Simulation::handleRequest(RequestEvent *requestEvent, RequestSource& source) {
 
     // Retrieves the plane from this event
     Plane plane = requestEvent->getPlane();
+    if (plane.getRequestTime() >= measureFrom) {
+        planesHandled++;
+    }
  
-    Event *event; //The compatible event to be created
-    std::string line; //The string storage used to read other line
-
     //Gets the first unoccupied runway in the list
     Runway *runway = runways->getUnoccupied();
 
@@ -199,24 +785,17 @@ void Simulation::handleRequest(RequestEvent *requestEvent, std::ifstream& fileSt
         //Assign the plane to the given runway, making it non-available this time:
         runway->assignPlane();
 
-        //Creates a compatible action event based on the request type:
-        if (currentPlane.getRequestType() == "takeoff") {
-            event = new TakeoffEvent(currentTime, currentPlane, runwayID);
-        } else if (currentPlane.getRequestType() == "landing") {
-            event = new LandingEvent(currentTime, currentPlane, runwayID);
-        } else {
-            throw std::invalid_argument("Request type not found");
-        }
-
-        //Enqueues this event once it is created:
-        eventQueue->enqueue(event);
+        //Schedules the takeoff or landing on this runway:
+        scheduleAction(currentPlane, runwayID);
 
     } 
 
-    //If it is not EOF yet, proceeds to process the new event for the next line, then enqueues it to the event queue:
-    if (std::getline(fileStream, line)) {
-        event = this->createEvent(line);
-        this->eventQueue->enqueue(event);
+    //If the source has more requests, proceeds to process the new event for the next one, then enqueues it to the event queue.
+    //A live source that cannot give it right away is waited for later, so that the events before it are not held back:
+    if (source.waitReady(std::chrono::steady_clock::time_point::min())) {
+        readRequest(source);
+    } else {
+        requestWanted = true;
     }
 
 }
@@ -236,7 +815,7 @@ void Simulation::handleAction(ActionEvent *actionEvent) {
     int id = actionEvent->getRunwayID();
 
     //Calculates the new time for complete event based on the total amount of time spent and the time when this event occurs
-    int newTime = actionEvent->calculateTotalTime() + actionEvent->getTime();
+    int newTime = serviceTime(actionEvent->getPlane()) + actionEvent->getTime();
 
     //Creates a complete event based on this new time and the same plane from the action event, then inserts it into the queue:
     Event *event = new CompleteEvent(newTime, actionEvent->getPlane(), id);
@@ -248,7 +827,7 @@ void Simulation::handleAction(ActionEvent *actionEvent) {
  * Handles the CompleteEvent type. An event is considered to be completed when the plane has cleared the runway after
  * landing and taking off. The following pseudocode describes the next operations:
  * 
- *  If the waiting line has not become empty (there is one more plane @ the front now) {
+ *  If the runway is still open and the waiting line has not become empty (there is one more plane @ the front now) {
  *	    create a Takeoff/Landing event for the next plane
  *      Insert this in the event queue
  *  }
@@ -265,88 +844,132 @@ void Simulation::handleComplete(CompleteEvent *completeEvent) {
 
     //Retrieves the runway ID and searches for the runway with this ID then clears it back to available:
     int runwayID = completeEvent->getRunwayID();
-    Runway *runway = runways->getRunway(runwayID);
-    runway->clearRunway();
+    Runway *runway = runways->clearRunway(runwayID);
 
-    //If the waitlist is not empty, proceeds to pull the next plane to takeoff or landing:
-    if (!waitList->isEmpty()) {
+    //If the runway is still open and the waitlist is not empty, proceeds to pull the next plane to takeoff or landing:
+    if (runway->isRunwayAvailable() && !waitList->isEmpty()) {
 
         //Removes the plane from the waitlist:
         Plane currentPlane = waitList->dequeue();
 
-        Event *event; //Event to be inserted into the queue
-
         //Assigns the plane to the recently freed runway:
         runway->assignPlane();
 
         //Calculate the wasted time by taking the difference between the current time and the time that this plane made the request:
         int wastedTime = currentTime - currentPlane.getRequestTime();
 
-        //Adds this time to the total tally:
-        totalWastedTime += wastedTime;
+        //Adds this time to the total tally (unless the plane requested during the warm-up):
+        if (currentPlane.getRequestTime() >= measureFrom) {
+            totalWastedTime += wastedTime;
+        }
+
+        //Schedules the takeoff or landing on this runway:
+        scheduleAction(currentPlane, runwayID);
+
+    }
+
+}
+
+/**
+ * Checks if a pending takeoff/landing would have been dequeued before the given event in the normal mode (see
+ * EventPriorityQueue::precedes(Event *, Event *)).
+ * @param time : The time of the takeoff/landing.
+ * @param plane : The plane taking off or landing.
+ * @param event : The event.
+ * @return true if the takeoff/landing comes first.
+ */
+static bool actionPrecedes(int time, const Plane& plane, Event *event) {
+    if (time != event->getTime()) {
+        return time < event->getTime();
+    }
+    if (plane.isTakeoff() != event->getPlane().isTakeoff()) {
+        return plane.isLanding();
+    }
+    return plane.getAtcId() < event->getPlane().getAtcId();
+}
+
+/**
+ * Assigns the plane to the given runway at the current time. A compatible Takeoff/Landing event is created for it and
+ * inserted into the event queue. In fused mode, the Complete event is scheduled right away instead and only a record of
+ * the takeoff/landing is kept until its log line is due (see Simulation::flushActions(Event *)).
+ * @param plane : The plane that has been cleared.
+ * @param runwayID : The ID of the runway assigned to this plane.
+ */
+void Simulation::scheduleAction(const Plane& plane, int runwayID) {
+
+    if (!plane.isTakeoff() && !plane.isLanding()) {
+        throw std::invalid_argument("Request type not found");
+    }
 
-        //Creates a compatible action event based on the request type:
-        if (currentPlane.getRequestType() == "takeoff") {
-            event = new TakeoffEvent(currentTime, currentPlane, runwayID);
-        } else if (currentPlane.getRequestType() == "landing") {
-            event = new LandingEvent(currentTime, currentPlane, runwayID);
+    //Normal mode: enqueues a compatible action event, Simulation::handleAction will schedule its completion:
+    if (!fused) {
+        if (plane.isTakeoff()) {
+            eventQueue->enqueue(new TakeoffEvent(currentTime, plane, runwayID));
         } else {
-            throw std::invalid_argument("Request type not found");
+            eventQueue->enqueue(new LandingEvent(currentTime, plane, runwayID));
+        }
+        return;
+    }
+
+    //Fused mode: schedules the complete event directly, then keeps a record of the takeoff/landing only for printing.
+    //Every pending record is at the current time, so the new one usually goes at the back:
+    eventQueue->enqueue(new CompleteEvent(serviceTime(plane) + currentTime, plane, runwayID));
+    std::deque<PendingAction>::iterator spot = pendingActions.end(); //Where the new record goes
+    while (spot != pendingActions.begin()) {
+        std::deque<PendingAction>::iterator previous = spot - 1;
+        if (previous->time < currentTime || (previous->plane.isLanding() && plane.isTakeoff())
+            || (previous->plane.isTakeoff() == plane.isTakeoff() && previous->plane.getAtcId() < plane.getAtcId())) {
+            break;
         }
+        spot = previous;
+    }
+    pendingActions.insert(spot, PendingAction{ currentTime, plane, runwayID });
 
-        //Enqueues this event once it is created:
-        eventQueue->enqueue(event);
+}
 
+/**
+ * Prints every pending takeoff/landing (fused mode only) that would have been dequeued before the given event in the
+ * normal mode, so that the output stays in the same order. The action event handed to the observer only lives on the
+ * stack.
+ * @param next : The next event to be handled, or nullptr to print every pending action.
+ */
+void Simulation::flushActions(Event *next) {
+
+    //Pops the pending records in order for as long as they come before the next event:
+    while (!pendingActions.empty() && (next == nullptr
+        || actionPrecedes(pendingActions.front().time, pendingActions.front().plane, next))) {
+        const PendingAction& action = pendingActions.front();
+        if (observer != nullptr) {
+            if (action.plane.isTakeoff()) {
+                TakeoffEvent event(action.time, action.plane, action.runwayID);
+                observer->onAction(event);
+            } else {
+                LandingEvent event(action.time, action.plane, action.runwayID);
+                observer->onAction(event);
+            }
+        }
+        pendingActions.pop_front();
     }
 
 }
 
 /**
- * Creates a request event based on the contents of this line. The following format is used to create plane
- * and the event associated with this plane:
- *      [time] [callSign] [flightNumber] [size] [requestType]
- * 
- * where: 
- *  [time]: an integer value representing the time (minute) of a plane requesting a runway.
- *  [callSign]: is a string (guaranteed to be one token with no spaces) representing the airline.
- *  [flightNumber]: is an integer value representing the flight number.
- *  [size]: is a string representing the size of the plane. It can only be either small, large, heavy or super.
- *  [requestType]: is a string representing what the plane is requesting. It can only be either takeoff or landing.
- * 
- * A special ATC ID is also assigned to each plane ordinally. The event is then created based on the requestType
- * and returned accordingly.
+ * Creates a request event for the given plane. The event is created based on the plane's request type and returned
+ * accordingly.
  * 
- * @param line : The input string containing the plane's information
+ * @param plane : The plane making this request (see Plane::parse(const std::string&, int) for the input format)
  * @return The event at the given time associating with this plane.
  */
-Event* Simulation::createEvent(const std::string& line) {
+Event* Simulation::createEvent(const Plane& plane) {
 
     Event *event; //The event to be created 
-    std::stringstream strstream(line); //The stream to token the input line
-    std::string token; //The tokens to be stored in each read
-    int time = 0; //The time where the request occurs
-    std::string callSign = ""; //The plane's callsign
-    int flightNum = 0; //The plane's flight number
-    std::string size = ""; //The size of this plane
-    std::string requestType = ""; //The request type for this plane
-    static Plane newPlane; //The plane object to be associated with this event.
-
-    strstream >> token;  //grabbing the next token (reading time)
-    time = std::stoi(token); //converting time (string format) to an int
-    strstream >> callSign;  //grabbing the next token (reading call sign)
-    strstream >> token;
-    flightNum = stoi(token);  //grabbing the next token (reading flight number)
-    strstream >> size;  //grabbing the next token (reading plane size)
-    strstream >> requestType;  //grabbing the next token (reading request type, either landing or takeoff)
-
-    //Creates a newPlane based on the input parameters:
-    newPlane = Plane(id++, callSign, flightNum, size, requestType, time);
+    int time = plane.getRequestTime(); //The time where the request occurs
 
     //Creates a compatible request event based on the request type, then returns this event:
-    if (requestType == "takeoff") {
-        event = new RequestTakeoffEvent(time, newPlane);
-    } else if (requestType == "landing") {
-        event = new RequestLandingEvent(time, newPlane);
+    if (plane.isTakeoff()) {
+        event = new RequestTakeoffEvent(time, plane);
+    } else if (plane.isLanding()) {
+        event = new RequestLandingEvent(time, plane);
     } else {
         throw std::invalid_argument("Incompatible request");
     }
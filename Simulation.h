@@ -1,7 +1,9 @@
 #pragma once
 
+#include <deque>
 #include <fstream>
 #include <sstream>
+#include <vector>
 
 #include "Runways.h"
 #include "EventPriorityQueue.h"
@@ -9,6 +11,11 @@
 #include "RequestEvent.h"
 #include "CompleteEvent.h"
 #include "ActionEvent.h"
+#include "RequestSource.h"
+#include "SimulationObserver.h"
+#include "PacedObserver.h"
+#include "SimulationResult.h"
+#include "StochasticModel.h"
 
 /**
  * Represents the whole airport simulation operation. The input file is read, and each event is created based on the 
@@ -18,12 +25,113 @@
 class Simulation {
 
     private:
+
+        /**
+         * A takeoff or landing scheduled in fused mode, kept only until its log line is due.
+         */
+        struct PendingAction {
+            int time; //The time of the takeoff or landing
+            Plane plane; //The plane taking off or landing
+            int runwayID; //The runway assigned to the plane
+        };
+
         int numRunways; //Number of runways (retrieved from command-line argument)
         Runways* runways; //The runway manager (storing runways and perform runway-related operations)
         EventPriorityQueue* eventQueue; //The event priority queue that are used to organize the events chronologically
         WaitList *waitList; //The wait list to assign each plane into position to either takeoff or land.
         int currentTime; //The current time to keep track of every event.
         int totalWastedTime; //The amount of time wasted for planes to wait for clearance.
+        bool fused; //Whether takeoff/landing events are fused with their complete events (see setFusedMode).
+        std::deque<PendingAction> pendingActions; //Takeoffs/landings waiting to be printed in fused mode, in queue order.
+        bool prefetch; //Whether the requests are read on a separate reader thread (see setPrefetchMode).
+        int loadThreads; //The number of threads loading the whole file at once, or -1 to read it line by line.
+        int reorderWindow; //The number of minutes that a request can be late by, or -1 if the file is in time order.
+        std::vector<std::string> feeds; //The input files of the other live feeds merged with the input file (see setFeeds).
+        ConsoleObserver console; //The observer used by default, printing every event onto the console.
+        SimulationObserver *observer; //The observer notified of every event (nullptr if none).
+        PacedObserver *pacer; //The wall clock of a paced simulation (nullptr if not paced).
+        bool requestWanted; //Whether the next request of a live source is still to be read (see awaitRequest).
+        int passedTime; //The last time reached by the wall clock before a live source had its requests in (or INT_MIN).
+        int planesHandled; //The number of requests handled so far.
+        bool started; //Whether the first request has been read from the source.
+        std::string checkpointFile; //The file receiving the checkpoints (empty if none).
+        int checkpointInterval; //The number of simulated minutes between two checkpoints.
+        bool resume; //Whether the simulation resumes from the checkpoint file (if it exists).
+        bool inputEnded; //Whether the source had no more requests the last time it was read.
+        bool pauseAtEndOfInput; //Whether Simulation::runUntil(RequestSource&, int) stops as soon as the input ends.
+        std::string incrementalFile; //The file keeping the state between incremental runs (empty if none).
+        bool windowed; //Whether only a time window of the input file is simulated (see setWindow).
+        int windowStart; //The first request time of the window.
+        int windowEnd; //The end of the window (the requests made at or after it are not read).
+        int warmup; //The number of minutes simulated before the window to fill the wait list and the runways.
+        int measureFrom; //The earliest request time counted in the totals (the planes requesting earlier are not counted).
+        const StochasticModel *model; //The model drawing the service times, or nullptr for the fixed service times.
+        int replica; //The number of the replica drawn from the model.
+
+        /**
+         * Assigns the plane to the given runway at the current time. A compatible Takeoff/Landing event is created for it and
+         * inserted into the event queue. In fused mode, the Complete event is scheduled right away instead and only a record of
+         * the takeoff/landing is kept until its log line is due (see Simulation::flushActions(Event *)).
+         * @param plane : The plane that has been cleared.
+         * @param runwayID : The ID of the runway assigned to this plane.
+         */
+        void scheduleAction(const Plane& plane, int runwayID);
+
+        /**
+         * Prints every pending takeoff/landing (fused mode only) that would have been dequeued before the given event in the
+         * normal mode, so that the output stays in the same order.
+         * @param next : The next event to be handled, or nullptr to print every pending action.
+         */
+        void flushActions(Event *next);
+
+        /**
+         * Handles one event removed from the event queue: prints any pending action that comes before it, updates the current
+         * time, handles the event and deallocates it once finished.
+         * @param event : The event removed from the event queue.
+         * @param source : The source of the requests, used to read the next request if there is one.
+         */
+        void dispatchEvent(Event *event, RequestSource& source);
+
+        /**
+         * Reads the next request of the source and puts its event into the event queue. In a paced simulation, a request
+         * of a live source that comes in after the wall clock has passed its time is handled at the current time.
+         * @param source : The source of the requests.
+         */
+        void readRequest(RequestSource& source);
+
+        /**
+         * Waits for the next request of a live source that could not be read right away, unless the next event comes
+         * before it: the source is only waited for while its watermark is not past the time of that event. In a paced
+         * simulation, it is only waited for until that event (or the earliest request held by the source) is due on the
+         * wall clock, then the requests not in by then are late (see RequestSource::passTime(int)).
+         * @param source : The source of the requests.
+         * @param time : The time of the next event, or INT_MAX if there is none.
+         */
+        void awaitRequest(RequestSource& source, int time);
+
+        /**
+         * Runs the simulation on the input file read line by line, handing a copy of the simulation to a CheckpointWriter
+         * every checkpoint interval in which an event was handled (the intervals without any event are skipped). If resuming,
+         * the state and the input position are restored from the checkpoint first.
+         * @param fileName : The name of the input file.
+         */
+        void runWithCheckpoints(const std::string& fileName);
+
+        /**
+         * Runs the simulation on the lines appended to the input file since the previous incremental run. The state saved
+         * by that run is restored first, then the new lines are handled until the end of the input, where the state is
+         * saved again (on a CheckpointWriter thread) before the remaining events are handled.
+         * @param fileName : The name of the input file.
+         */
+        void runIncremental(const std::string& fileName);
+
+        /**
+         * Returns the time that the given plane occupies its runway: Plane::getServiceTime(), or a time drawn around it by
+         * the stochastic model if there is one.
+         * @param plane : The plane taking off or landing.
+         * @return The service time in minutes.
+         */
+        int serviceTime(const Plane& plane) const;
     
     public:
 
@@ -33,6 +141,175 @@ class Simulation {
          */
         Simulation(int numRunways);
 
+        /**
+         * Forks the given simulation: constructs an independent copy of its whole state (runways, event queue, wait list,
+         * pending actions, options and counters) so that both can continue on their own, even on different threads. The
+         * copy keeps notifying the same observer, except the default console observer which is its own. The input position
+         * is not part of the simulation, so the copy must be continued on a copy of the source (see RequestSource::fork()).
+         * @param other : The simulation to be forked, usually stopped by Simulation::runUntil(RequestSource&, int).
+         */
+        Simulation(const Simulation& other);
+
+        /**
+         * Turns the fused execution mode on or off. In fused mode, assigning a runway directly schedules the Complete event
+         * instead of going through the event queue once more with a Takeoff/Landing event. The output stays the same.
+         * @param fused : true to enable the fused mode, false to use the normal mode.
+         */
+        void setFusedMode(bool fused);
+
+        /**
+         * Turns the prefetching of requests on or off. When it is on, the input file is read and parsed on a separate reader
+         * thread ahead of the simulation (see PrefetchRequestSource).
+         * @param prefetch : true to read the requests on a reader thread, false to read them on the simulation thread.
+         */
+        void setPrefetchMode(bool prefetch);
+
+        /**
+         * Makes the simulation load the whole input file in one pass before starting, parsed in parallel by TraceLoader.
+         * @param numThreads : The number of threads parsing the file (0 uses every core), or -1 to read it line by line.
+         */
+        void setLoadThreads(int numThreads);
+
+        /**
+         * Makes the simulation accept an input file whose requests can be out of order by up to the given number of minutes.
+         * The requests are put back in time order by a ReorderRequestSource before being handled.
+         * @param window : The number of minutes that a request can be late by, or -1 if the file is in time order.
+         */
+        void setReorderWindow(int window);
+
+        /**
+         * Makes the simulation merge the input file with other live feeds, each one read on its own thread and pushed into
+         * a MultiFeedRequestSource, which releases the requests of every feed in time order.
+         * @param feeds : The input files of the other feeds, each one sorted by request time (empty for none).
+         */
+        void setFeeds(const std::vector<std::string>& feeds);
+
+        /**
+         * Makes the simulation write a checkpoint every given number of simulated minutes (see CheckpointWriter). The input
+         * file is then read line by line on the simulation thread, whatever the other options are.
+         * @param fileName : The name of the checkpoint file, or an empty string for no checkpoints.
+         * @param interval : The number of simulated minutes between two checkpoints.
+         */
+        void setCheckpoint(const std::string& fileName, int interval);
+
+        /**
+         * Makes the simulation resume from its checkpoint file (see Simulation::setCheckpoint(const std::string&, int)) if
+         * it exists, instead of starting from the beginning of the input file.
+         * @param resume : true to resume from the latest checkpoint.
+         */
+        void setResume(bool resume);
+
+        /**
+         * Makes the simulation incremental: the state at the end of the input is saved into the given file, and the next run
+         * with the same file restores it and only reads the lines appended to the input file since then. Only the lines
+         * ending with a line break are read.
+         * @param fileName : The name of the state file, or an empty string to run the whole input file.
+         */
+        void setIncremental(const std::string& fileName);
+
+        /**
+         * Makes the simulation only read the requests of the input file made within the given time window, starting a
+         * warm-up period before the window so that the wait list and the runways are already busy when it starts. The
+         * input file must be sorted by request time: its TraceIndex is used to seek straight to the start of the warm-up
+         * instead of reading the file from the beginning. Only the requests made within the window are counted in the
+         * totals.
+         * @param start : The first request time of the window.
+         * @param end : The end of the window (the requests made at or after it are not read).
+         * @param warmup : The number of minutes simulated before the window (0 for none).
+         */
+        void setWindow(int start, int end, int warmup);
+
+        /**
+         * Makes the service times random: each one is drawn by the given model for the given replica instead of being
+         * Plane::getServiceTime(). The request times are left as they are (see JitterRequestSource).
+         * @param model : The model drawing the service times (not owned by this simulation), or nullptr for fixed times.
+         * @param replica : The number of the replica drawn from the model.
+         */
+        void setStochasticModel(const StochasticModel *model, int replica);
+
+        /**
+         * Sets the observer receiving every event handled by this simulation. By default, the events are printed onto the
+         * console by a ConsoleObserver.
+         * @param observer : The observer to be notified (not owned by this simulation), or nullptr to run silently.
+         */
+        void setObserver(SimulationObserver *observer);
+
+        /**
+         * Sets the wall clock of a paced simulation, usually the observer as well (see setObserver). A live source (see
+         * MultiFeedRequestSource) is then only waited for until the next event is due, so that a quiet feed does not
+         * hold back the events of the other ones.
+         * @param pacer : The paced observer (not owned by this simulation), or nullptr if not paced.
+         */
+        void setPacer(PacedObserver *pacer);
+
+        /**
+         * Runs the whole simulation on the requests stored in memory, without printing anything unless an observer prints it.
+         * The planes are served in order with their own ATC IDs. A simulation object is meant to be run only once.
+         * @param begin : The plane of the first request.
+         * @param end : One past the plane of the last request.
+         * @return The summary of the simulation.
+         */
+        SimulationResult run(const Plane *begin, const Plane *end);
+
+        /**
+         * Runs the whole simulation on the requests of the given source, without printing anything unless an observer prints it.
+         * A simulation object is meant to be run only once.
+         * @param source : The source of the requests, read one at a time.
+         * @return The summary of the simulation.
+         */
+        SimulationResult run(RequestSource& source);
+
+        /**
+         * Runs the simulation on the requests of the given source until every event happening at or before the given time
+         * is handled, then stops so that it can be forked or continued later by another call with the same source.
+         * @param source : The source of the requests, read one at a time.
+         * @param time : The last time to be simulated.
+         * @return true if there are events left after this time, false if the simulation has ended.
+         */
+        bool runUntil(RequestSource& source, int time);
+
+        /**
+         * Writes the whole state of the simulation in binary form: the counters, the runways, the event queue, the pending
+         * actions and the wait list. The options and the observer are not written.
+         * @param out : The binary output stream.
+         */
+        void writeState(std::ostream& out) const;
+
+        /**
+         * Reads the state written by Simulation::writeState(std::ostream&) into this simulation, which must be new and have
+         * the same number of runways. The simulation continues from there with the source at the same position.
+         * @param in : The binary input stream.
+         */
+        void readState(std::istream& in);
+
+        /**
+         * Reads the source once more after the input ended, in case new requests were added since then. The request read
+         * (if any) is put into the event queue, exactly as Simulation::handleRequest(RequestEvent *, RequestSource&)
+         * would have done if it had been there at that time.
+         * @param source : The source of the requests, read one at a time.
+         */
+        void resumeInput(RequestSource& source);
+
+        /**
+         * Returns the time of the next event to be handled, for example to know how far a simulation stopped by
+         * Simulation::runUntil(RequestSource&, int) has to go next.
+         * @return The time of the first event in the event queue, or INT_MAX if it is empty.
+         */
+        int getNextEventTime();
+
+        /**
+         * Closes the runway with the given ID from the current time on. The plane on it (if any) still clears it, but no
+         * other plane is assigned to it afterwards.
+         * @param runwayID : The ID of the runway to be closed.
+         */
+        void closeRunway(int runwayID);
+
+        /**
+         * Returns the summary of the simulation so far.
+         * @return The number of runways, the total wasted time, the number of requests handled and the current time.
+         */
+        SimulationResult getResult() const;
+
         /**
          * Handles the given event. The event is typecasted to check for either of the folowing 3 subevents:
          * 
@@ -45,16 +322,16 @@ class Simulation {
          * 
          * Based on the subtypes of the events, it is handled separately by the methods described below:
          * 
-         *      Simulation::handleRequest(RequestEvent *requestEvent, std::ifstream& fileStream);
+         *      Simulation::handleRequest(RequestEvent *requestEvent, RequestSource& source);
          * 
          *      Simulation::handleAction(ActionEvent *actionEvent);
          * 
          *      Simulation::handleComplete(CompleteEvent *completeEvent);
          *
          * @param event : The event to be handled properly.
-         * @param fileStream : The input file stream to be used in reading request if it is not EOF.
+         * @param source : The source of the requests, used to read the next request if there is one.
          */
-        void handleEvent(Event *event, std::ifstream& fileStream);
+        void handleEvent(Event *event, RequestSource& source);
 
         /**
          * Starts the simulation by reading the inputFile and perform controlled simulation.
@@ -68,18 +345,29 @@ class Simulation {
          *  Open data file
          *  Read the first request event from file and put it in the event queue
          *  While event queue is not empty { 
-         *      Remove the first event from the event queue 
-         *      Process that event, summarize data
+         *      Remove every event sharing the time of the first event from the event queue 
+         *      For each removed event, in order {
+         *          Process the new events of this time that come before it (if any)
+         *          Process that event, summarize data
+         *      }
          *  }
          *
          * @param inputFile : the input file to handle the file reading actions.
          */
         void startSimulation(const std::string& inputFile);
 
+        /**
+         * Starts the simulation on the requests of the given source. This is the same algorithm as
+         * Simulation::startSimulation(const std::string&) without the starting message. If the simulation was stopped by
+         * Simulation::runUntil(RequestSource&, int), it continues from there.
+         * @param source : The source of the requests, read one at a time.
+         */
+        void startSimulation(RequestSource& source);
+
         /**
          * Handles the RequestEvent type. An event is considered to be a request is when the plane first makes one with the ATC for permission
          * on either landing or takeoff.
-         * This method also receives the ifstream associating with the input file passed in the beginning. The pseudocode for this algorithm is:
+         * This method also receives the source of the requests passed in the beginning. The pseudocode for this algorithm is:
          * 
          *  Add new plane to waiting line
          *  If one of the runways is available {
@@ -87,14 +375,14 @@ class Simulation {
          *      create a Takeoff/Landing event 
          *      Insert this in order in the event queue
          *  }
-         *  If not EOF {
-         *      Read the next request event from the file and insert that in the event queue
+         *  If the source has more requests {
+         *      Read the next request event from the source and insert that in the event queue
          *  } 
          * 
          * @param requestEvent : The request event to be handled.
-         * @param fileStream : The input file stream to be used in reading request if it is not EOF.
+         * @param source : The source of the requests, used to read the next request if there is one.
          */
-        void handleRequest(RequestEvent *requestEvent, std::ifstream& fileStream);
+        void handleRequest(RequestEvent *requestEvent, RequestSource& source);
 
         /**
          * Handles the ActionEvent type. An event is considered to be an action is when the ATC allows plane to either land
@@ -111,7 +399,7 @@ class Simulation {
          * Handles the CompleteEvent type. An event is considered to be completed when the plane has cleared the runway after
          * landing and taking off. The following pseudocode describes the next operations:
          * 
-         *  If the waiting line has not become empty (there is one more plane @ the front now) {
+         *  If the runway is still open and the waiting line has not become empty (there is one more plane @ the front now) {
          *	    create a Takeoff/Landing event for the next plane
          *      Insert this in the event queue
          *  }
@@ -130,24 +418,13 @@ class Simulation {
         int getTotalWastedMinutes();
 
         /**
-         * Creates a request event based on the contents of this line. The following format is used to create plane
-         * and the event associated with this plane:
-         *      [time] [callSign] [flightNumber] [size] [requestType]
-         * 
-         * where: 
-         *  [time]: an integer value representing the time (minute) of a plane requesting a runway.
-         *  [callSign]: is a string (guaranteed to be one token with no spaces) representing the airline.
-         *  [flightNumber]: is an integer value representing the flight number.
-         *  [size]: is a string representing the size of the plane. It can only be either small, large, heavy or super.
-         *  [requestType]: is a string representing what the plane is requesting. It can only be either takeoff or landing.
-         * 
-         * A special ATC ID is also assigned to each plane ordinally. The event is then created based on the requestType
-         * and returned accordingly.
+         * Creates a request event for the given plane. The event is created based on the plane's request type and returned
+         * accordingly.
          * 
-         * @param line : The input string containing the plane's information
+         * @param plane : The plane making this request (see Plane::parse(const std::string&, int) for the input format)
          * @return The event at the given time associating with this plane.
          */
-        Event* createEvent(const std::string& line);
+        Event* createEvent(const Plane& plane);
 
         /**
          * Prints the summary after the simulation has ended. The information contains the number of runways assigned
@@ -156,7 +433,7 @@ class Simulation {
          * @param numberRunways : The number of runways associated with the simulation
          * @param wastedMinutes : The total amount of wasted time.
          */
-        void printSummary(const int& numberRunways, const int& wastedMinutes);
+        static void printSummary(const int& numberRunways, const int& wastedMinutes);
 
         /**
          * Destroys and frees any resources associating with this simulation: the waitlist, event queue and the runways 
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "CorePolicies.h"
+#include "CoreQueues.h"
+#include "MemoryRequestSource.h"
+#include "RequestSource.h"
+#include "SimulationResult.h"
+
+/**
+ * The scheduling loop of the Simulation class with its three building blocks chosen at compile time instead of being
+ * heap-allocated objects behind virtual calls:
+ *
+ *      - Queue: the backend of the event queue and of the wait list (see CoreQueues.h).
+ *
+ *      - WaitPolicy: the order of the planes waiting for a runway (see CorePolicies.h).
+ *
+ *      - RunwayPolicy: which free runway a plane is given (see CorePolicies.h).
+ *
+ * The events are plain values (a kind, a time, a runway and a CoreTicket) handled by a switch, so every comparison and
+ * every handler can be inlined into the loop. The requests are read one at a time from the source and each plane goes
+ * through a request, an action and a complete event, exactly like in the Simulation class, so DefaultSimulationCore
+ * gives the same total wasted time. Nothing is printed.
+ *
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+template <template <typename, typename> class Queue, typename WaitPolicy, typename RunwayPolicy>
+class SimulationCore {
+
+    private:
+
+        /**
+         * The kinds of events, as in the Simulation class.
+         */
+        enum Kind { REQUEST, ACTION, COMPLETE };
+
+        /**
+         * An event of the queue.
+         */
+        struct CoreEvent {
+            int time; //The time when the event happens
+            Kind kind; //The kind of event
+            int runwayID; //The runway of the plane (0 for a request)
+            CoreTicket plane; //The plane of the event
+        };
+
+        /**
+         * The order of the EventPriorityQueue: the earlier time, then landings before takeoffs, then the lower ATC ID.
+         */
+        struct EarlierEvent {
+            bool operator()(const CoreEvent& event1, const CoreEvent& event2) const {
+                if (event1.time != event2.time) {
+                    return event1.time < event2.time;
+                }
+                if (event1.plane.takeoff != event2.plane.takeoff) {
+                    return event2.plane.takeoff;
+                }
+                return event1.plane.atcId < event2.plane.atcId;
+            }
+        };
+
+        int numRunways; //Number of runways of this simulation.
+        RunwayPolicy runways; //The runways, handed out by the runway policy.
+        Queue<CoreEvent, EarlierEvent> eventQueue; //The events, in the order they happen.
+        Queue<CoreTicket, WaitPolicy> waitList; //The planes waiting for a runway, in the order of the wait policy.
+        int currentTime; //The current time to keep track of every event.
+        int totalWastedTime; //The amount of time wasted for planes to wait for clearance.
+        int planesHandled; //The number of requests handled so far.
+
+        /**
+         * Reads the next request of the source (if any) and puts its request event into the queue.
+         * @param source : The source of the requests.
+         */
+        void readNext(RequestSource& source) {
+            Plane plane; //The plane of the next request
+            if (source.next(plane)) {
+                CoreTicket ticket = { plane.isTakeoff(), plane.getRequestTime(), plane.getAtcId(),
+                    plane.getServiceTime() };
+                eventQueue.push(CoreEvent{ ticket.requestTime, REQUEST, 0, ticket });
+            }
+        }
+
+        /**
+         * Handles a request: puts the plane in line, gives the next plane in line a runway if one is free, then reads the
+         * next request.
+         * @param event : The request event.
+         * @param source : The source of the requests.
+         */
+        void handleRequest(const CoreEvent& event, RequestSource& source) {
+            planesHandled++;
+            waitList.push(event.plane);
+            int runwayID = runways.acquire();
+            if (runwayID != 0) {
+                CoreTicket next = waitList.top();
+                waitList.pop();
+                eventQueue.push(CoreEvent{ currentTime, ACTION, runwayID, next });
+            }
+            readNext(source);
+        }
+
+        /**
+         * Handles a takeoff or landing: the runway is cleared once the plane has used it.
+         * @param event : The action event.
+         */
+        void handleAction(const CoreEvent& event) {
+            eventQueue.push(CoreEvent{ currentTime + event.plane.serviceTime, COMPLETE, event.runwayID, event.plane });
+        }
+
+        /**
+         * Handles a cleared runway: the next plane in line (if any) gets a runway and its waiting time is added to the
+         * total tally.
+         * @param event : The complete event.
+         */
+        void handleComplete(const CoreEvent& event) {
+            runways.release(event.runwayID);
+            if (!waitList.empty()) {
+                CoreTicket next = waitList.top();
+                waitList.pop();
+                totalWastedTime += currentTime - next.requestTime;
+                eventQueue.push(CoreEvent{ currentTime, ACTION, runways.acquire(), next });
+            }
+        }
+
+    public:
+
+        /**
+         * Builds a simulation based on the number of runways.
+         * @param numRunways : The number of runways that this simulation holds.
+         */
+        SimulationCore(int numRunways) : runways(numRunways) {
+            this->numRunways = numRunways;
+            currentTime = 0;
+            totalWastedTime = 0;
+            planesHandled = 0;
+        }
+
+        /**
+         * Runs the whole simulation on the requests of the given source. A simulation object is meant to be run only once.
+         * @param source : The source of the requests, read one at a time.
+         * @return The summary of the simulation.
+         */
+        SimulationResult run(RequestSource& source) {
+
+            readNext(source);
+
+            while (!eventQueue.empty()) {
+
+                CoreEvent event = eventQueue.top();
+                eventQueue.pop();
+                currentTime = event.time;
+
+                switch (event.kind) {
+                    case REQUEST:
+                        handleRequest(event, source);
+                        break;
+                    case ACTION:
+                        handleAction(event);
+                        break;
+                    case COMPLETE:
+                        handleComplete(event);
+                        break;
+                }
+
+            }
+
+            SimulationResult result;
+            result.numRunways = numRunways;
+            result.totalWastedMinutes = totalWastedTime;
+            result.planesHandled = planesHandled;
+            result.endTime = currentTime;
+            return result;
+
+        }
+
+        /**
+         * Runs the whole simulation on the requests stored in memory. A simulation object is meant to be run only once.
+         * @param begin : The plane of the first request.
+         * @param end : One past the plane of the last request.
+         * @return The summary of the simulation.
+         */
+        SimulationResult run(const Plane *begin, const Plane *end) {
+            MemoryRequestSource source(begin, end);
+            return run(source);
+        }
+
+};
+
+//The instantiation behaving like the Simulation class: sorted lists, the WaitList order and the lowest free runway.
+typedef SimulationCore<SortedListQueue, LandingFirst, LowestFreeRunway> DefaultSimulationCore;
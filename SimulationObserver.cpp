@@ -0,0 +1,53 @@
+/**
+ * This file is the implementation of the SimulationObserver.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "SimulationObserver.h"
+
+/**
+ * Called when a plane makes its request to land or take off.
+ * @param event : The request event being handled.
+ */
+void SimulationObserver::onRequest(const RequestEvent&) {}
+
+/**
+ * Called when a plane is cleared to land or take off on a runway.
+ * @param event : The takeoff or landing event being handled.
+ */
+void SimulationObserver::onAction(const ActionEvent&) {}
+
+/**
+ * Called when a plane has cleared its runway.
+ * @param event : The complete event being handled.
+ */
+void SimulationObserver::onComplete(const CompleteEvent&) {}
+
+/**
+ * Destructor for the observer.
+ */
+SimulationObserver::~SimulationObserver() {}
+
+/**
+ * Prints the request event onto the console.
+ * @param event : The request event being handled.
+ */
+void ConsoleObserver::onRequest(const RequestEvent& event) {
+    event.processEvent();
+}
+
+/**
+ * Prints the takeoff or landing event onto the console.
+ * @param event : The takeoff or landing event being handled.
+ */
+void ConsoleObserver::onAction(const ActionEvent& event) {
+    event.processEvent();
+}
+
+/**
+ * Prints the complete event onto the console.
+ * @param event : The complete event being handled.
+ */
+void ConsoleObserver::onComplete(const CompleteEvent& event) {
+    event.processEvent();
+}
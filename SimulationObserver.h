@@ -0,0 +1,67 @@
+#pragma once
+
+#include "RequestEvent.h"
+#include "ActionEvent.h"
+#include "CompleteEvent.h"
+
+/**
+ * Receives every event handled by a Simulation, in the order they happen. Each method does nothing by default, so a
+ * subclass only overrides the kinds of events that it needs. The events are only valid during the call.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class SimulationObserver {
+
+    public:
+
+        /**
+         * Called when a plane makes its request to land or take off.
+         * @param event : The request event being handled.
+         */
+        virtual void onRequest(const RequestEvent& event);
+
+        /**
+         * Called when a plane is cleared to land or take off on a runway.
+         * @param event : The takeoff or landing event being handled.
+         */
+        virtual void onAction(const ActionEvent& event);
+
+        /**
+         * Called when a plane has cleared its runway.
+         * @param event : The complete event being handled.
+         */
+        virtual void onComplete(const CompleteEvent& event);
+
+        /**
+         * Destructor for the observer.
+         */
+        virtual ~SimulationObserver();
+
+};
+
+/**
+ * The observer used by default: it prints every event onto the console with Event::processEvent().
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class ConsoleObserver : public SimulationObserver {
+
+    public:
+
+        /**
+         * Prints the request event onto the console.
+         * @param event : The request event being handled.
+         */
+        void onRequest(const RequestEvent& event) override;
+
+        /**
+         * Prints the takeoff or landing event onto the console.
+         * @param event : The takeoff or landing event being handled.
+         */
+        void onAction(const ActionEvent& event) override;
+
+        /**
+         * Prints the complete event onto the console.
+         * @param event : The complete event being handled.
+         */
+        void onComplete(const CompleteEvent& event) override;
+
+};
@@ -0,0 +1,12 @@
+#pragma once
+
+/**
+ * The summary of a finished simulation, returned by Simulation::run so that it can be used without reading the console.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+struct SimulationResult {
+    int numRunways; //The number of runways of the simulation.
+    int totalWastedMinutes; //The total amount of time wasted because runways were not available.
+    int planesHandled; //The number of requests handled.
+    int endTime; //The time of the last event handled.
+};
@@ -0,0 +1,212 @@
+/**
+ * This file is the implementation of the SimulationServer.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "SimulationServer.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <stdexcept>
+#include <thread>
+
+#ifndef _WIN32
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+
+/**
+ * Constructs a server on the given socket path.
+ * @param socketPath : The path of the Unix domain socket to create.
+ * @param numWorkers : The number of worker threads (0 uses every core).
+ */
+SimulationServer::SimulationServer(const std::string& socketPath, unsigned numWorkers) : stopping(false) {
+    this->socketPath = socketPath;
+    this->wakePipe[0] = -1;
+    this->wakePipe[1] = -1;
+    this->numWorkers = (numWorkers == 0) ? std::max(1u, std::thread::hardware_concurrency()) : numWorkers;
+}
+
+#ifndef _WIN32
+
+/**
+ * Creates the socket, starts the worker threads and accepts connections until stop() is called. The workers are
+ * joined and the socket is removed before returning.
+ */
+void SimulationServer::serve() {
+
+    sockaddr_un address = sockaddr_un(); //The address of the socket
+    int server = socket(AF_UNIX, SOCK_STREAM, 0); //The listening socket
+
+    if (server < 0 || socketPath.size() >= sizeof(address.sun_path)) {
+        throw std::runtime_error("Cannot create socket " + socketPath);
+    }
+    address.sun_family = AF_UNIX;
+    socketPath.copy(address.sun_path, socketPath.size());
+
+    //Replaces any socket left by a previous run, then starts listening:
+    unlink(socketPath.c_str());
+    if (bind(server, (sockaddr *) &address, sizeof(address)) < 0 || listen(server, SOMAXCONN) < 0 || pipe(wakePipe) < 0) {
+        close(server);
+        throw std::runtime_error("Cannot listen on " + socketPath);
+    }
+
+    for (unsigned i = 0; i < numWorkers; i++) {
+        workers.push_back(std::thread(&SimulationServer::work, this));
+    }
+
+    //Hands every new connection to the workers, until stop() writes into the pipe:
+    pollfd watched[2] = { { server, POLLIN, 0 }, { wakePipe[0], POLLIN, 0 } }; //The listening socket and the pipe
+    while (!stopping.load()) {
+        if (poll(watched, 2, -1) <= 0 || !(watched[0].revents & POLLIN)) {
+            continue;
+        }
+        int client = accept(server, nullptr, nullptr);
+        if (client < 0) {
+            continue;
+        }
+        std::lock_guard<std::mutex> guard(clientsLock);
+        clients.push(client);
+        clientReady.notify_one();
+    }
+
+    close(server);
+    unlink(socketPath.c_str());
+
+    //Closes the connections not handled yet, and ends the ones being handled once their current query is answered:
+    {
+        std::lock_guard<std::mutex> guard(clientsLock);
+        while (!clients.empty()) {
+            close(clients.front());
+            clients.pop();
+        }
+        for (std::set<int>::iterator client = activeClients.begin(); client != activeClients.end(); ++client) {
+            shutdown(*client, SHUT_RD);
+        }
+        clientReady.notify_all();
+    }
+
+    for (size_t i = 0; i < workers.size(); i++) {
+        workers[i].join();
+    }
+    workers.clear();
+
+    close(wakePipe[0]);
+    close(wakePipe[1]);
+    wakePipe[0] = -1;
+    wakePipe[1] = -1;
+
+}
+
+/**
+ * Asks the server to stop. Can be called from any thread, and from a signal handler.
+ */
+void SimulationServer::stop() {
+    stopping.store(true);
+    if (wakePipe[1] >= 0) {
+        ssize_t written = write(wakePipe[1], "", 1);
+        (void) written;
+    }
+}
+
+/**
+ * Body of each worker thread: handles the waiting connections one at a time, until the server stops.
+ */
+void SimulationServer::work() {
+    while (true) {
+        int client;
+        {
+            std::unique_lock<std::mutex> guard(clientsLock);
+            clientReady.wait(guard, [this]() { return !clients.empty() || stopping.load(); });
+            if (clients.empty()) {
+                return;
+            }
+            client = clients.front();
+            clients.pop();
+            activeClients.insert(client);
+        }
+        handleClient(client);
+        std::lock_guard<std::mutex> guard(clientsLock);
+        activeClients.erase(client);
+        close(client);
+    }
+}
+
+/**
+ * Answers every query of a connection until the client closes it (or the server stops). The socket is closed by the
+ * caller.
+ * @param client : The socket of the connection.
+ */
+void SimulationServer::handleClient(int client) {
+
+    std::string pending; //The data received but not answered yet
+    char buffer[4096]; //The data of one receive
+    ssize_t received;
+
+    while ((received = recv(client, buffer, sizeof(buffer), 0)) > 0) {
+
+        pending.append(buffer, received);
+
+        //Answers every complete line received so far:
+        size_t lineBreak;
+        while ((lineBreak = pending.find('\n')) != std::string::npos) {
+            std::string reply = runner.answer(pending.substr(0, lineBreak)) + '\n';
+            pending.erase(0, lineBreak + 1);
+            if (!sendAll(client, reply)) {
+                return;
+            }
+        }
+
+    }
+
+}
+
+/**
+ * Sends the whole reply, calling send() again for the bytes that a call left unsent or when a call is interrupted
+ * by a signal.
+ * @param client : The socket of the connection.
+ * @param reply : The reply to be sent.
+ * @return true if every byte was sent, false if the connection failed.
+ */
+bool SimulationServer::sendAll(int client, const std::string& reply) {
+
+    size_t sent = 0; //The number of bytes of the reply sent so far
+
+    while (sent < reply.size()) {
+        ssize_t count = send(client, reply.data() + sent, reply.size() - sent, MSG_NOSIGNAL);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        sent += count;
+    }
+
+    return true;
+
+}
+
+#else
+
+/**
+ * Unix domain sockets are not available on Windows.
+ */
+void SimulationServer::serve() {
+    throw std::runtime_error("The server mode is not supported on Windows");
+}
+
+void SimulationServer::stop() {}
+
+void SimulationServer::work() {}
+
+void SimulationServer::handleClient(int) {}
+
+bool SimulationServer::sendAll(int, const std::string&) {
+    return false;
+}
+
+#endif
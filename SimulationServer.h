@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ScenarioRunner.h"
+
+/**
+ * A long-running server answering simulation queries over a local Unix domain socket (not available on Windows). The
+ * queries are run by a ScenarioRunner, which keeps the traces in memory, so a query only costs the simulation itself.
+ * Each connection can send any number of queries, one per line, each one answered by one line (see ScenarioRunner for
+ * the format). The connections are handled by a pool of worker threads.
+ *
+ * The server runs until SimulationServer::stop() is called (for example from a signal handler): it then stops accepting
+ * connections, lets the queries being run finish, closes every connection and joins the workers.
+ *
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class SimulationServer {
+
+    private:
+
+        std::string socketPath; //The path of the Unix domain socket.
+        unsigned numWorkers; //The number of worker threads.
+        ScenarioRunner runner; //Runs the queries, keeping the traces in memory.
+        std::queue<int> clients; //The connections waiting for a worker.
+        std::mutex clientsLock; //Protects the connections waiting.
+        std::condition_variable clientReady; //Wakes up a worker when a connection is waiting or the server stops.
+        std::set<int> activeClients; //The connections being handled by a worker (protected by clientsLock).
+        std::vector<std::thread> workers; //The worker threads.
+        std::atomic<bool> stopping; //Whether the server has been asked to stop.
+        int wakePipe[2]; //The pipe written by stop() to wake the accept loop up (-1 when closed).
+
+        /**
+         * Body of each worker thread: handles the waiting connections one at a time, until the server stops.
+         */
+        void work();
+
+        /**
+         * Answers every query of a connection until the client closes it (or the server stops). The socket is closed by the
+         * caller.
+         * @param client : The socket of the connection.
+         */
+        void handleClient(int client);
+
+        /**
+         * Sends the whole reply, calling send() again for the bytes that a call left unsent or when a call is interrupted
+         * by a signal.
+         * @param client : The socket of the connection.
+         * @param reply : The reply to be sent.
+         * @return true if every byte was sent, false if the connection failed.
+         */
+        static bool sendAll(int client, const std::string& reply);
+
+    public:
+
+        /**
+         * Constructs a server on the given socket path.
+         * @param socketPath : The path of the Unix domain socket to create.
+         * @param numWorkers : The number of worker threads (0 uses every core).
+         */
+        SimulationServer(const std::string& socketPath, unsigned numWorkers = 0);
+
+        /**
+         * Creates the socket, starts the worker threads and accepts connections until stop() is called. The workers are
+         * joined and the socket is removed before returning.
+         */
+        void serve();
+
+        /**
+         * Asks the server to stop. Can be called from any thread, and from a signal handler.
+         */
+        void stop();
+
+};
@@ -0,0 +1,159 @@
+/**
+ * This file is the implementation of the StochasticModel.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "StochasticModel.h"
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+#include "Philox.h"
+
+constexpr auto JITTER_STREAM = 0; //The kind of draw of the request jitter
+constexpr auto SERVICE_STREAM = 1; //The kind of draw of the service time noise
+constexpr auto TWO_PI = 6.283185307179586;
+
+/**
+ * Constructs the model.
+ * @param seed : The seed of every draw.
+ * @param jitter : The largest number of minutes that a request can be moved by, either way (uniform).
+ * @param service : The distribution of the noise added to the service times, in one of these forms: "fixed:V",
+ * "uniform:A:B", "normal:MEAN:SD" or "exponential:MEAN".
+ */
+StochasticModel::StochasticModel(uint64_t seed, int jitter, const std::string& service) {
+
+    if (jitter < 0) {
+        throw std::invalid_argument("The jitter must not be negative");
+    }
+
+    key[0] = (uint32_t) seed;
+    key[1] = (uint32_t) (seed >> 32);
+    this->jitter = jitter;
+    antithetic = false;
+
+    //Splits the distribution into its name and its parameters:
+    std::stringstream fields(service);
+    std::string name;
+    std::string value;
+    std::getline(fields, name, ':');
+    parameter1 = std::getline(fields, value, ':') ? std::stod(value) : 0;
+    parameter2 = std::getline(fields, value, ':') ? std::stod(value) : 0;
+
+    if (name == "fixed") {
+        kind = Kind::FIXED;
+    } else if (name == "uniform") {
+        kind = Kind::UNIFORM;
+    } else if (name == "normal") {
+        kind = Kind::NORMAL;
+    } else if (name == "exponential") {
+        kind = Kind::EXPONENTIAL;
+    } else {
+        throw std::invalid_argument("Unknown distribution " + service);
+    }
+
+}
+
+/**
+ * Turns the antithetic variates on or off.
+ * @param antithetic : true to make the odd replicas mirror the numbers of the even ones.
+ */
+void StochasticModel::setAntithetic(bool antithetic) {
+    this->antithetic = antithetic;
+}
+
+/**
+ * Checks if the replicas go by antithetic pairs.
+ * @return true if the odd replicas mirror the numbers of the even ones.
+ */
+bool StochasticModel::isAntithetic() const {
+    return antithetic;
+}
+
+/**
+ * Draws the two uniform numbers of a plane for one kind of draw.
+ * @param replica : The number of the replica.
+ * @param atcId : The ATC ID of the plane.
+ * @param stream : The kind of draw (0 for the jitter, 1 for the service time).
+ * @param uniform1 : Receives the first uniform number, strictly between 0 and 1.
+ * @param uniform2 : Receives the second uniform number, strictly between 0 and 1.
+ * @return true if the numbers must be mirrored (the second replica of an antithetic pair).
+ */
+bool StochasticModel::draw(int replica, int atcId, int stream, double& uniform1, double& uniform2) const {
+
+    //Both replicas of an antithetic pair share the numbers of the pair:
+    uint32_t counter[4] = { (uint32_t) atcId, (uint32_t) (antithetic ? replica / 2 : replica), (uint32_t) stream, 0 };
+    Philox::generate(counter, key);
+    uniform1 = Philox::toUniform(counter[0]);
+    uniform2 = Philox::toUniform(counter[1]);
+    return antithetic && replica % 2 == 1;
+
+}
+
+/**
+ * Returns the largest number of minutes that a request can be moved by, either way.
+ * @return The jitter bound.
+ */
+int StochasticModel::getJitter() const {
+    return jitter;
+}
+
+/**
+ * Draws the number of minutes that the request of a plane is moved by.
+ * @param replica : The number of the replica.
+ * @param atcId : The ATC ID of the plane.
+ * @return A number between -jitter and jitter.
+ */
+int StochasticModel::sampleJitter(int replica, int atcId) const {
+
+    if (jitter == 0) {
+        return 0;
+    }
+
+    double uniform1;
+    double uniform2;
+    if (draw(replica, atcId, JITTER_STREAM, uniform1, uniform2)) {
+        uniform1 = 1 - uniform1;
+    }
+    return (int) std::floor(uniform1 * (2 * jitter + 1)) - jitter;
+
+}
+
+/**
+ * Draws the time that a plane occupies its runway: the deterministic time plus the noise, rounded to the minute and
+ * at least one minute.
+ * @param baseTime : The deterministic time (see Plane::getServiceTime()).
+ * @param replica : The number of the replica.
+ * @param atcId : The ATC ID of the plane.
+ * @return The service time in minutes.
+ */
+int StochasticModel::sampleServiceTime(int baseTime, int replica, int atcId) const {
+
+    double uniform1;
+    double uniform2;
+    double noise = 0; //The noise added to the deterministic time
+    bool mirrored = draw(replica, atcId, SERVICE_STREAM, uniform1, uniform2);
+    double uniform = mirrored ? 1 - uniform1 : uniform1; //The mirrored uniform number for the inverse transforms
+
+    switch (kind) {
+        case Kind::FIXED:
+            noise = parameter1;
+            break;
+        case Kind::UNIFORM:
+            noise = parameter1 + uniform * (parameter2 - parameter1);
+            break;
+        case Kind::NORMAL:
+            //Box-Muller transform, whose mirror is the opposite draw:
+            noise = std::sqrt(-2 * std::log(uniform1)) * std::cos(TWO_PI * uniform2);
+            noise = parameter1 + parameter2 * (mirrored ? -noise : noise);
+            break;
+        case Kind::EXPONENTIAL:
+            noise = -parameter1 * std::log(uniform);
+            break;
+    }
+
+    long serviceTime = std::lround(baseTime + noise);
+    return (serviceTime < 1) ? 1 : (int) serviceTime;
+
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/**
+ * The random parts of a stochastic simulation: a jitter added to every request time, and a noise added to the time that
+ * each plane occupies its runway (see Plane::getServiceTime()).
+ *
+ * Every draw comes from the Philox generator keyed by the seed, with the replica number, the ATC ID of the plane and the
+ * kind of draw as the counter. A plane therefore gets the same random numbers in a given replica whatever the order of
+ * the draws, the thread running the replica or the other replicas running at the same time. This also gives common
+ * random numbers: the same replica run with another number of runways sees the same jitters and service times, so the
+ * difference between both configurations is not blurred by the randomness.
+ *
+ * With antithetic variates, the replicas go by pairs (0 and 1, 2 and 3...): the second replica of a pair uses the same
+ * numbers as the first one, mirrored (u becomes 1 - u, and a normal draw changes sign), so that the errors of both
+ * replicas tend to cancel out in their average.
+ *
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class StochasticModel {
+
+    private:
+
+        /**
+         * The kinds of distributions of the service time noise.
+         */
+        enum class Kind {
+            FIXED, //Always the first parameter
+            UNIFORM, //Uniform between the two parameters
+            NORMAL, //Normal with the first parameter as the mean and the second one as the standard deviation
+            EXPONENTIAL //Exponential with the first parameter as the mean
+        };
+
+        uint32_t key[2]; //The Philox key, made from the seed
+        int jitter; //The largest number of minutes that a request can be moved by, either way
+        Kind kind; //The distribution of the service time noise
+        double parameter1; //The first parameter of the distribution
+        double parameter2; //The second parameter of the distribution
+        bool antithetic; //Whether the odd replicas mirror the numbers of the even ones
+
+        /**
+         * Draws the two uniform numbers of a plane for one kind of draw.
+         * @param replica : The number of the replica.
+         * @param atcId : The ATC ID of the plane.
+         * @param stream : The kind of draw (0 for the jitter, 1 for the service time).
+         * @param uniform1 : Receives the first uniform number, strictly between 0 and 1.
+         * @param uniform2 : Receives the second uniform number, strictly between 0 and 1.
+         * @return true if the numbers must be mirrored (the second replica of an antithetic pair).
+         */
+        bool draw(int replica, int atcId, int stream, double& uniform1, double& uniform2) const;
+
+    public:
+
+        /**
+         * Constructs the model.
+         * @param seed : The seed of every draw.
+         * @param jitter : The largest number of minutes that a request can be moved by, either way (uniform).
+         * @param service : The distribution of the noise added to the service times, in one of these forms: "fixed:V",
+         * "uniform:A:B", "normal:MEAN:SD" or "exponential:MEAN".
+         */
+        StochasticModel(uint64_t seed, int jitter, const std::string& service);
+
+        /**
+         * Turns the antithetic variates on or off.
+         * @param antithetic : true to make the odd replicas mirror the numbers of the even ones.
+         */
+        void setAntithetic(bool antithetic);
+
+        /**
+         * Checks if the replicas go by antithetic pairs.
+         * @return true if the odd replicas mirror the numbers of the even ones.
+         */
+        bool isAntithetic() const;
+
+        /**
+         * Returns the largest number of minutes that a request can be moved by, either way.
+         * @return The jitter bound.
+         */
+        int getJitter() const;
+
+        /**
+         * Draws the number of minutes that the request of a plane is moved by.
+         * @param replica : The number of the replica.
+         * @param atcId : The ATC ID of the plane.
+         * @return A number between -jitter and jitter.
+         */
+        int sampleJitter(int replica, int atcId) const;
+
+        /**
+         * Draws the time that a plane occupies its runway: the deterministic time plus the noise, rounded to the minute and
+         * at least one minute.
+         * @param baseTime : The deterministic time (see Plane::getServiceTime()).
+         * @param replica : The number of the replica.
+         * @param atcId : The ATC ID of the plane.
+         * @return The service time in minutes.
+         */
+        int sampleServiceTime(int baseTime, int replica, int atcId) const;
+
+};
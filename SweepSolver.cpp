@@ -0,0 +1,261 @@
+/**
+ * This file is the implementation of the SweepSolver.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "SweepSolver.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <queue>
+#include <stdexcept>
+#include <vector>
+
+#include "LandingEvent.h"
+#include "Size.h"
+
+/**
+ * A busy runway: only the clearance time and the plane on it matter for the total wasted time.
+ */
+struct BusySlot {
+    int freeAt; //The time when the runway is cleared.
+    bool takeoff; //Whether the plane on this runway is taking off.
+    int atcId; //The ATC ID of the plane on this runway.
+};
+
+/**
+ * A plane waiting in line for a runway.
+ */
+struct WaitingPlane {
+    bool takeoff; //Whether the plane is requesting a takeoff.
+    int requestTime; //The time when the plane made its request.
+    int atcId; //The ATC ID of the plane.
+    int totalTime; //The time that the plane will occupy the runway.
+};
+
+/**
+ * Orders the busy runways so that the one cleared first is at the top of the heap (clearance time, then landings
+ * before takeoffs, then ATC ID).
+ */
+struct LaterSlot {
+    bool operator()(const BusySlot& slot1, const BusySlot& slot2) const {
+        if (slot1.freeAt != slot2.freeAt) {
+            return slot1.freeAt > slot2.freeAt;
+        }
+        if (slot1.takeoff != slot2.takeoff) {
+            return slot1.takeoff;
+        }
+        return slot1.atcId > slot2.atcId;
+    }
+};
+
+/**
+ * Orders the waiting planes the same way as the WaitList (landings first, then request time, then ATC ID).
+ */
+struct LowerPriority {
+    bool operator()(const WaitingPlane& plane1, const WaitingPlane& plane2) const {
+        if (plane1.takeoff != plane2.takeoff) {
+            return plane1.takeoff;
+        }
+        if (plane1.requestTime != plane2.requestTime) {
+            return plane1.requestTime > plane2.requestTime;
+        }
+        return plane1.atcId > plane2.atcId;
+    }
+};
+
+/**
+ * Skips the blanks (but not the line breaks) starting at the given position.
+ * @param current : The current position, updated past the blanks.
+ * @param end : One past the last character of the buffer.
+ */
+static void skipBlanks(const char *&current, const char *end) {
+    while (current < end && (*current == ' ' || *current == '\t' || *current == '\r')) {
+        current++;
+    }
+}
+
+/**
+ * Reads the next token starting at the given position.
+ * @param current : The current position, updated past the token.
+ * @param end : One past the last character of the buffer.
+ * @param length : The length of the token read.
+ * @return The first character of the token.
+ */
+static const char *readToken(const char *&current, const char *end, size_t& length) {
+    skipBlanks(current, end);
+    const char *token = current;
+    while (current < end && *current != ' ' && *current != '\t' && *current != '\r' && *current != '\n') {
+        current++;
+    }
+    length = current - token;
+    return token;
+}
+
+/**
+ * Reads the next token as an integer.
+ * @param current : The current position, updated past the integer.
+ * @param end : One past the last character of the buffer.
+ * @return The integer read.
+ */
+static int readInt(const char *&current, const char *end) {
+    size_t length;
+    const char *token = readToken(current, end, length);
+    const char *digit = token;
+    bool negative = length > 0 && *digit == '-';
+    if (negative || (length > 0 && *digit == '+')) {
+        digit++;
+    }
+    if (digit == token + length) {
+        throw std::invalid_argument("Number expected");
+    }
+    int value = 0;
+    for (; digit < token + length; digit++) {
+        if (*digit < '0' || *digit > '9') {
+            throw std::invalid_argument("Number expected");
+        }
+        value = value * 10 + (*digit - '0');
+    }
+    return negative ? -value : value;
+}
+
+/**
+ * Checks if the token is the same as the given word.
+ * @param token : The first character of the token.
+ * @param length : The length of the token.
+ * @param word : The word to compare with.
+ * @return true if both are the same.
+ */
+static bool tokenIs(const char *token, size_t length, const char *word) {
+    return length == std::strlen(word) && std::strncmp(token, word, length) == 0;
+}
+
+/**
+ * Reads the whole input file into memory at once, then sweeps over its lines to compute the total wasted time.
+ * @param fileName : The input file containing one request per line.
+ * @param numRunways : The number of runways of the airport.
+ * @return The total amount of minutes wasted.
+ */
+int SweepSolver::solve(const std::string& fileName, int numRunways) {
+
+    //Reads the file in a single pass into one buffer:
+    std::ifstream inputFile(fileName, std::ios::binary);
+    std::vector<char> buffer((std::istreambuf_iterator<char>(inputFile)), std::istreambuf_iterator<char>());
+
+    return solve(buffer.data(), buffer.data() + buffer.size(), numRunways);
+
+}
+
+/**
+ * Sweeps over the requests stored in the given buffer to compute the total wasted time. The buffer uses the same
+ * format as the input file.
+ * @param begin : The first character of the buffer.
+ * @param end : One past the last character of the buffer.
+ * @param numRunways : The number of runways of the airport.
+ * @return The total amount of minutes wasted.
+ */
+int SweepSolver::solve(const char *begin, const char *end, int numRunways) {
+
+    std::priority_queue<BusySlot, std::vector<BusySlot>, LaterSlot> busy; //The busy runways
+    std::priority_queue<WaitingPlane, std::vector<WaitingPlane>, LowerPriority> waiting; //The waiting line
+    int freeRunways = numRunways; //The number of free runways
+    int totalWastedTime = 0; //The amount of time wasted for planes to wait for clearance.
+    int id = 1; //The ATC ID of the next request
+    const char *current = begin; //The current position in the buffer
+
+    while (current < end) {
+
+        //Rejects the empty lines like Plane::parse(const std::string&, int) does (the end of the buffer after the last line
+        //break is not a line):
+        const char *lineStart = current; //The first character of the line
+        skipBlanks(current, end);
+        if (current == end && current == lineStart) {
+            break;
+        }
+        if (current == end || *current == '\n') {
+            throw std::invalid_argument("Empty request line");
+        }
+
+        //Reads the request: [time] [callSign] [flightNumber] [size] [requestType]
+        size_t length;
+        const char *token;
+        WaitingPlane plane;
+        plane.requestTime = readInt(current, end);
+        readToken(current, end, length);
+        readInt(current, end);
+
+        token = readToken(current, end, length);
+        int wake; //The wake turbulence duration, see Plane::getWakeTurbulenceDuration()
+        if (tokenIs(token, length, "small")) {
+            wake = (int) Size::SMALL;
+        } else if (tokenIs(token, length, "large")) {
+            wake = (int) Size::LARGE;
+        } else if (tokenIs(token, length, "heavy")) {
+            wake = (int) Size::HEAVY;
+        } else if (tokenIs(token, length, "super")) {
+            wake = (int) Size::SUPER;
+        } else {
+            throw std::invalid_argument("Plane type cannot be determined");
+        }
+
+        token = readToken(current, end, length);
+        if (tokenIs(token, length, "takeoff")) {
+            plane.takeoff = true;
+            plane.totalTime = Plane::calculateServiceTime(false, wake);
+        } else if (tokenIs(token, length, "landing")) {
+            plane.takeoff = false;
+            plane.totalTime = Plane::calculateServiceTime(true, wake);
+        } else {
+            throw std::invalid_argument("Incompatible request");
+        }
+        plane.atcId = id++;
+
+        //Moves to the next line:
+        while (current < end && *current++ != '\n') {}
+
+        //Clears every runway that becomes free before this request, giving it to the next plane in line:
+        while (!busy.empty()) {
+            const BusySlot& earliest = busy.top();
+            bool before = earliest.freeAt != plane.requestTime ? earliest.freeAt < plane.requestTime
+                : earliest.takeoff != plane.takeoff ? !earliest.takeoff
+                : earliest.atcId < plane.atcId;
+            if (!before) {
+                break;
+            }
+            int time = earliest.freeAt;
+            busy.pop();
+            if (waiting.empty()) {
+                freeRunways++;
+            } else {
+                WaitingPlane next = waiting.top();
+                waiting.pop();
+                totalWastedTime += time - next.requestTime;
+                busy.push(BusySlot{ time + next.totalTime, next.takeoff, next.atcId });
+            }
+        }
+
+        //Assigns a free runway if there is one, otherwise the plane waits in line:
+        if (freeRunways > 0) {
+            freeRunways--;
+            busy.push(BusySlot{ plane.requestTime + plane.totalTime, plane.takeoff, plane.atcId });
+        } else {
+            waiting.push(plane);
+        }
+
+    }
+
+    //No more requests, every waiting plane gets the next runway that clears (without any runway, they wait forever and
+    //are never counted, like in the Simulation class):
+    while (!waiting.empty() && !busy.empty()) {
+        int time = busy.top().freeAt;
+        busy.pop();
+        WaitingPlane next = waiting.top();
+        waiting.pop();
+        totalWastedTime += time - next.requestTime;
+        busy.push(BusySlot{ time + next.totalTime, next.takeoff, next.atcId });
+    }
+
+    return totalWastedTime;
+
+}
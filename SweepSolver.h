@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+
+/**
+ * Computes the total wasted time of a simulation without creating any Event, Plane or Runway objects. Since the rules are
+ * fixed (landings beat takeoffs, the lowest free runway is assigned first and each plane occupies its runway for the same
+ * time as Plane::getServiceTime()), the whole simulation is a single sweep over the requests in file order with
+ * a heap of busy runways and a heap of waiting planes.
+ *
+ * The busy runways and the waiting planes are ordered the same way as in RunwayHeapSimulation, so the result is the same
+ * as Simulation::getTotalWastedMinutes() for the same file and number of runways.
+ *
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class SweepSolver {
+
+    public:
+
+        /**
+         * Reads the whole input file into memory at once, then sweeps over its lines to compute the total wasted time.
+         * @param fileName : The input file containing one request per line.
+         * @param numRunways : The number of runways of the airport.
+         * @return The total amount of minutes wasted.
+         */
+        static int solve(const std::string& fileName, int numRunways);
+
+        /**
+         * Sweeps over the requests stored in the given buffer to compute the total wasted time. The buffer uses the same
+         * format as the input file.
+         * @param begin : The first character of the buffer.
+         * @param end : One past the last character of the buffer.
+         * @param numRunways : The number of runways of the airport.
+         * @return The total amount of minutes wasted.
+         */
+        static int solve(const char *begin, const char *end, int numRunways);
+
+};
@@ -25,19 +25,10 @@ TakeoffEvent::TakeoffEvent(const TakeoffEvent& takeoffEvent) : ActionEvent(takeo
  * Prints the event information onto the console. The following information is displayed for this event:
  * TIME: [time] -> [plane] cleared for takeoff on runway [runwayID] (time req. for takeoff: [totalTime])
  */
-void TakeoffEvent::processEvent() {
+void TakeoffEvent::processEvent() const {
 	std::cout << "TIME: " << this->startTime << " -> " << this->plane << " clear for takeoff on runway " << this->runwayID << " (time req. for takeoff: " << calculateTotalTime() << ")" << std::endl;
 }
 
-/**
- * Calculates the total amount of time needed for a plane to land and clear the runway. 
- * It is computed by the formula: totalTime = RUNWAY_USAGE + plane's turbulence duration.
- * @return The total time that the plane might use and clear the runway.
- */
-int TakeoffEvent::calculateTotalTime() {
-    return RUNWAY_USAGE + this->plane.getWakeTurbulenceDuration();
-}
-
 /**
  * Deallocates this event after it was done.
  */
@@ -31,14 +31,7 @@ class TakeoffEvent : public ActionEvent {
          * Prints the event information onto the console. The following information is displayed for this event:
          * TIME: [time] -> [plane] cleared for takeoff on runway [runwayID] (time req. for takeoff: [totalTime])
          */
-        void processEvent() override;
-
-        /**
-         * Calculates the total amount of time needed for a plane to land and clear the runway. 
-         * It is computed by the formula: totalTime = RUNWAY_USAGE + plane's turbulence duration.
-         * @return The total time that the plane might use and clear the runway.
-         */
-        int calculateTotalTime() override;
+        void processEvent() const override;
 
         /**
          * Deallocates this event after it was done.
@@ -0,0 +1,54 @@
+/**
+ * This file is the implementation of the FusedModeTest.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "FusedModeTest.h"
+
+#include "../Simulation.h"
+#include "ScheduleRecorder.h"
+#include "TestSupport.h"
+
+/**
+ * Runs one trace and records its schedule.
+ * @param planes : The planes of the trace.
+ * @param runways : The number of runways.
+ * @param fused : Whether the fused mode is on.
+ * @param recorder : The recorder receiving every event.
+ * @return The summary of the simulation.
+ */
+static SimulationResult record(const std::vector<Plane>& planes, int runways, bool fused, ScheduleRecorder& recorder) {
+    Simulation simulation(runways);
+    simulation.setFusedMode(fused);
+    simulation.setObserver(&recorder);
+    return simulation.run(planes.data(), planes.data() + planes.size());
+}
+
+/**
+ * Compares the schedule and summary of the fused mode with the ones of the normal mode on one trace.
+ * @param trace : The content of the trace (unused).
+ * @param planes : The planes of the trace.
+ * @param runways : The number of runways.
+ * @param expected : The summary of the normal mode.
+ * @param name : The trace and runways compared, for the messages.
+ */
+static void compareFused(const std::string&, const std::vector<Plane>& planes, int runways,
+    const SimulationResult& expected, const std::string& name) {
+
+    ScheduleRecorder normal;
+    ScheduleRecorder fused;
+    record(planes, runways, false, normal);
+    SimulationResult actual = record(planes, runways, true, fused);
+
+    TestSupport::expectSameResult(actual, expected, "the fused mode " + name);
+    fused.expectSameSchedule(normal, "the fused mode " + name);
+
+}
+
+/**
+ * Runs every check of this suite.
+ * @param traces : The sample trace files.
+ */
+void FusedModeTest::run(const std::vector<std::string>& traces) {
+    TestSupport::compareWithSimulation(traces, compareFused);
+}
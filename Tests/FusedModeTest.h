@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+/**
+ * Cross-checks the fused mode of the Simulation class against its normal mode: the fused run must hand the observer
+ * the same events in the same order, and give the same summary, on the sample traces and on random traces, for every
+ * number of runways (including none).
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class FusedModeTest {
+
+    public:
+
+        /**
+         * Runs every check of this suite.
+         * @param traces : The sample trace files.
+         */
+        static void run(const std::vector<std::string>& traces);
+
+};
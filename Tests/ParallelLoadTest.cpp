@@ -0,0 +1,94 @@
+/**
+ * This file is the implementation of the ParallelLoadTest.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "ParallelLoadTest.h"
+
+#include <sstream>
+
+#include "../Simulation.h"
+#include "../TraceLoader.h"
+#include "ScheduleRecorder.h"
+#include "TestSupport.h"
+
+constexpr unsigned LOAD_THREADS[] = { 2, 3, 4, 8 }; //The numbers of threads compared by the tests.
+constexpr auto LOAD_TEST_RUNWAYS = 2; //The number of runways of the simulations compared by the tests.
+
+/**
+ * Parses the trace one line at a time, giving the ATC IDs in line order like FileRequestSource does.
+ * @param trace : The content of the trace.
+ * @return The planes of every request, in file order.
+ */
+static std::vector<Plane> parseSequentially(const std::string& trace) {
+    std::vector<Plane> planes;
+    std::istringstream lines(trace);
+    std::string line;
+    while (std::getline(lines, line)) {
+        planes.push_back(Plane::parse(line, (int) planes.size() + 1));
+    }
+    return planes;
+}
+
+/**
+ * Runs one trace and records its schedule.
+ * @param planes : The planes of the trace.
+ * @param recorder : The recorder receiving every event.
+ */
+static void record(const std::vector<Plane>& planes, ScheduleRecorder& recorder) {
+    Simulation simulation(LOAD_TEST_RUNWAYS);
+    simulation.setObserver(&recorder);
+    simulation.run(planes.data(), planes.data() + planes.size());
+}
+
+/**
+ * Compares the planes loaded in parallel with the planes read one line at a time, for every number of threads.
+ * @param trace : The content of the trace.
+ * @param name : The name of the trace, for the messages.
+ */
+static void compareLoads(const std::string& trace, const std::string& name) {
+
+    std::vector<Plane> expected = parseSequentially(trace);
+    ScheduleRecorder expectedSchedule;
+    record(expected, expectedSchedule);
+
+    for (unsigned threads : LOAD_THREADS) {
+
+        std::string suffix = " with " + std::to_string(threads) + " threads on " + name;
+        std::vector<Plane> actual = TraceLoader::parse(trace, threads);
+        if (!TestSupport::expectEqual(actual.size(), expected.size(), "Requests loaded" + suffix)) {
+            continue;
+        }
+
+        //Every field of every plane, so that a chunk boundary splitting a line shows up as the first plane it breaks:
+        for (size_t i = 0; i < actual.size(); i++) {
+            const Plane& a = actual[i];
+            const Plane& e = expected[i];
+            if (a.getAtcId() != e.getAtcId() || a.getRequestTime() != e.getRequestTime()
+                || a.getCallSign() != e.getCallSign() || a.getFlightNumber() != e.getFlightNumber()
+                || a.getSize() != e.getSize() || a.getRequestType() != e.getRequestType()) {
+                TestSupport::expect(false, "Request " + std::to_string(i + 1) + " loaded" + suffix);
+                break;
+            }
+        }
+
+        ScheduleRecorder actualSchedule;
+        record(actual, actualSchedule);
+        actualSchedule.expectSameSchedule(expectedSchedule, "the planes loaded" + suffix);
+
+    }
+
+}
+
+/**
+ * Runs every check of this suite.
+ * @param traces : The sample trace files.
+ */
+void ParallelLoadTest::run(const std::vector<std::string>& traces) {
+
+    TestSupport::forEachTrace(traces, compareLoads);
+
+    //More threads than lines, and a last line without a line break:
+    compareLoads("1 Delta 1243 heavy takeoff\n5 Emirates 1598 super landing", "a trace of two lines");
+
+}
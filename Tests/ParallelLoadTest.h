@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+/**
+ * Cross-checks the parallel parse of TraceLoader against the sequential one: whatever the number of threads, it must
+ * give the same planes, with the same ATC IDs, as reading the trace one line at a time, and the Simulation class must
+ * then give the same schedule on both.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class ParallelLoadTest {
+
+    public:
+
+        /**
+         * Runs every check of this suite.
+         * @param traces : The sample trace files.
+         */
+        static void run(const std::vector<std::string>& traces);
+
+};
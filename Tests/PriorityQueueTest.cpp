@@ -0,0 +1,231 @@
+/**
+ * This file is the implementation of the PriorityQueueTest.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "PriorityQueueTest.h"
+
+#include <deque>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../PriorityQueue.h"
+#include "TestSupport.h"
+
+constexpr auto QUEUE_TEST_ROUNDS = 40; //The number of rounds of random operations on each queue.
+constexpr auto QUEUE_TEST_SEEDS = 3; //The number of seeds run on each backend.
+
+/**
+ * A node of the queues under test: a key with many duplicates, then a unique ID so that the order is a strict total one.
+ */
+struct TestNode : PriorityQueueHook<TestNode> {
+    int key; //The priority of the node
+    int id; //The number of the node, breaking the ties between equal keys
+};
+
+/**
+ * The order of the queues under test: the lower key first, then the lower ID.
+ */
+struct TestBefore {
+    bool operator()(const TestNode& node1, const TestNode& node2) const {
+        return node1.key != node2.key ? node1.key < node2.key : node1.id < node2.id;
+    }
+};
+
+/**
+ * The same order for std::priority_queue, which puts the greatest element at the top.
+ */
+struct TestAfter {
+    bool operator()(const TestNode *node1, const TestNode *node2) const {
+        return TestBefore()(*node2, *node1);
+    }
+};
+
+typedef std::priority_queue<TestNode *, std::vector<TestNode *>, TestAfter> ReferenceQueue;
+
+/**
+ * Checks that a queue lists its nodes in the same order as the reference queue.
+ * @param queue : The queue under test.
+ * @param reference : The reference queue (copied, since it can only be listed by popping it).
+ * @return true if both lists are the same.
+ */
+template <typename Queue>
+static bool sameOrder(const Queue& queue, ReferenceQueue reference) {
+    std::vector<TestNode *> nodes; //The nodes listed by the queue under test
+    queue.inOrder(nodes);
+    if (nodes.size() != reference.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < nodes.size(); i++) {
+        if (nodes[i] != reference.top()) {
+            return false;
+        }
+        reference.pop();
+    }
+    return true;
+}
+
+/**
+ * Runs random pushes and pops on one backend and on std::priority_queue side by side, then pops both down to empty.
+ * @param name : The name of the backend, for the messages.
+ * @param seed : The seed of the operations.
+ */
+template <typename Backend>
+static void compare(const std::string& name, unsigned seed) {
+
+    std::mt19937 random(seed);
+    PriorityQueue<TestNode, TestBefore, Backend> queue;
+    ReferenceQueue reference;
+    std::deque<TestNode> nodes; //The storage of every node (a deque never moves them)
+    bool sameFront = true; //Whether top() and pop() always gave the node of the reference
+    bool sameSize = true; //Whether size() and empty() always agreed with the reference
+    bool sameList = true; //Whether inOrder() always listed the nodes of the reference in its order
+
+    for (int round = 0; round < QUEUE_TEST_ROUNDS; round++) {
+
+        //Each round has its own number of operations and range of keys, from all equal to mostly distinct:
+        int operations = random() % 2000;
+        int keys = 1 + random() % 50;
+
+        for (int i = 0; i < operations; i++) {
+            if (random() % 3 != 0 || reference.empty()) {
+                nodes.push_back(TestNode());
+                nodes.back().key = random() % keys;
+                nodes.back().id = nodes.size();
+                queue.push(&nodes.back());
+                reference.push(&nodes.back());
+            } else {
+                TestNode *front = queue.top(); //The front node before the pop
+                TestNode *popped = queue.pop(); //The node removed by the pop
+                sameFront = sameFront && front == reference.top() && popped == reference.top();
+                reference.pop();
+            }
+            sameSize = sameSize && queue.size() == reference.size() && queue.empty() == reference.empty();
+        }
+
+        sameList = sameList && sameOrder(queue, reference);
+
+    }
+
+    //Pops everything left:
+    bool sameDrain = true; //Whether every pop down to empty gave the node of the reference
+    while (!reference.empty() && !queue.empty()) {
+        TestNode *popped = queue.pop(); //The node removed by the pop
+        sameDrain = sameDrain && popped == reference.top();
+        reference.pop();
+    }
+    sameDrain = sameDrain && reference.empty();
+
+    std::string suffix = " of " + name + " with seed " + std::to_string(seed);
+    TestSupport::expect(sameFront, "Front nodes" + suffix);
+    TestSupport::expect(sameSize, "Sizes" + suffix);
+    TestSupport::expect(sameList, "Nodes listed in order" + suffix);
+    TestSupport::expect(sameDrain, "Nodes popped down to empty" + suffix);
+    TestSupport::expect(queue.empty() && queue.size() == 0 && queue.top() == nullptr, "Empty queue" + suffix);
+
+}
+
+/**
+ * Checks that SortedList::popWhile cuts off the same nodes as popping the reference while they satisfy the predicate,
+ * and leaves the rest of the list in order.
+ * @param seed : The seed of the nodes.
+ */
+static void comparePopWhile(unsigned seed) {
+
+    std::mt19937 random(seed);
+    PriorityQueue<TestNode, TestBefore, SortedList> queue;
+    ReferenceQueue reference;
+    std::deque<TestNode> nodes; //The storage of every node
+    bool sameRuns = true; //Whether every run cut off was the run of the reference
+
+    for (int i = 0; i < 2000; i++) {
+        nodes.push_back(TestNode());
+        nodes.back().key = random() % 100;
+        nodes.back().id = i;
+        queue.push(&nodes.back());
+        reference.push(&nodes.back());
+    }
+
+    //Cuts off every node under a growing limit, sometimes none at all:
+    for (int limit = 0; limit <= 100; limit += 1 + random() % 10) {
+        TestNode *run = queue.popWhile([limit](const TestNode& node) {
+            return node.key < limit;
+        });
+        for (; run != nullptr; run = run->queueNext) {
+            if (reference.empty()) {
+                sameRuns = false;
+                break;
+            }
+            sameRuns = sameRuns && run == reference.top() && run->key < limit;
+            reference.pop();
+        }
+        sameRuns = sameRuns && (reference.empty() || reference.top()->key >= limit);
+        sameRuns = sameRuns && queue.size() == reference.size() && sameOrder(queue, reference);
+    }
+
+    TestSupport::expect(sameRuns, "Runs cut off by SortedList::popWhile with seed " + std::to_string(seed));
+
+}
+
+/**
+ * Checks that SortedList::assign gives the same queue as pushing the nodes one at a time, whatever the number of nodes,
+ * and that the queue then takes pushes and pops like any other.
+ * @param seed : The seed of the nodes.
+ */
+static void compareAssign(unsigned seed) {
+
+    std::mt19937 random(seed);
+    bool sameQueues = true; //Whether every assigned queue was the queue of the reference
+
+    for (int count = 0; count <= 200; count += 1 + random() % 20) {
+
+        PriorityQueue<TestNode, TestBefore, SortedList> queue;
+        ReferenceQueue reference;
+        std::deque<TestNode> nodes; //The storage of every node
+
+        for (int i = 0; i < count; i++) {
+            nodes.push_back(TestNode());
+            nodes.back().key = random() % 10;
+            nodes.back().id = i;
+            reference.push(&nodes.back());
+        }
+
+        //Assigns the nodes in the order of the reference:
+        std::vector<TestNode *> ordered; //The nodes, front first
+        for (ReferenceQueue copy = reference; !copy.empty(); copy.pop()) {
+            ordered.push_back(copy.top());
+        }
+        queue.assign(ordered);
+        sameQueues = sameQueues && queue.size() == reference.size() && sameOrder(queue, reference);
+
+        //Then pushes a node that goes in the middle and pops the front:
+        nodes.push_back(TestNode());
+        nodes.back().key = 5;
+        nodes.back().id = count;
+        queue.push(&nodes.back());
+        reference.push(&nodes.back());
+        sameQueues = sameQueues && queue.pop() == reference.top();
+        reference.pop();
+        sameQueues = sameQueues && queue.size() == reference.size() && sameOrder(queue, reference);
+
+    }
+
+    TestSupport::expect(sameQueues, "Queues filled by SortedList::assign with seed " + std::to_string(seed));
+
+}
+
+/**
+ * Runs every check of this suite.
+ */
+void PriorityQueueTest::run() {
+    for (unsigned seed = 1; seed <= QUEUE_TEST_SEEDS; seed++) {
+        compare<SortedList>("SortedList", seed);
+        compare<DaryHeap<2> >("DaryHeap<2>", seed);
+        compare<DaryHeap<4> >("DaryHeap<4>", seed);
+        compare<PairingHeap>("PairingHeap", seed);
+        comparePopWhile(seed);
+        compareAssign(seed);
+    }
+}
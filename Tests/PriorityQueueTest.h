@@ -0,0 +1,18 @@
+#pragma once
+
+/**
+ * Cross-checks every backend of the PriorityQueue template (SortedList, DaryHeap<2>, DaryHeap<4> and PairingHeap) against
+ * std::priority_queue: random pushes and pops with many equal keys, the front, the size and the order listed by inOrder()
+ * along the way, then every pop down to an empty queue. The single cut of SortedList::popWhile is checked as well.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class PriorityQueueTest {
+
+    public:
+
+        /**
+         * Runs every check of this suite.
+         */
+        static void run();
+
+};
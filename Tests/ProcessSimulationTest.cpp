@@ -0,0 +1,33 @@
+/**
+ * This file is the implementation of the ProcessSimulationTest.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "ProcessSimulationTest.h"
+
+#include "../MemoryRequestSource.h"
+#include "../ProcessSimulation.h"
+#include "TestSupport.h"
+
+/**
+ * Compares the summary of the process-oriented engine with the summary of the Simulation class on one trace.
+ * @param trace : The content of the trace (unused).
+ * @param planes : The planes of the trace.
+ * @param runways : The number of runways.
+ * @param expected : The summary of the Simulation class.
+ * @param name : The trace and runways compared, for the messages.
+ */
+static void compareProcesses(const std::string&, const std::vector<Plane>& planes, int runways,
+    const SimulationResult& expected, const std::string& name) {
+    MemoryRequestSource source(planes.data(), planes.data() + planes.size());
+    ProcessSimulation simulation(runways);
+    TestSupport::expectSameResult(simulation.run(source), expected, "ProcessSimulation " + name);
+}
+
+/**
+ * Runs every check of this suite.
+ * @param traces : The sample trace files.
+ */
+void ProcessSimulationTest::run(const std::vector<std::string>& traces) {
+    TestSupport::compareWithSimulation(traces, compareProcesses);
+}
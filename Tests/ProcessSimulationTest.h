@@ -0,0 +1,21 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+/**
+ * Cross-checks ProcessSimulation against the Simulation class: the process-oriented engine must give the same summary
+ * on the sample traces and on random traces, for every number of runways (including none).
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class ProcessSimulationTest {
+
+    public:
+
+        /**
+         * Runs every check of this suite.
+         * @param traces : The sample trace files.
+         */
+        static void run(const std::vector<std::string>& traces);
+
+};
@@ -0,0 +1,86 @@
+/**
+ * This file is the implementation of the ReorderTest.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "ReorderTest.h"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+
+#include "../MemoryRequestSource.h"
+#include "../ReorderRequestSource.h"
+#include "../Simulation.h"
+#include "ScheduleRecorder.h"
+#include "TestSupport.h"
+
+constexpr int REORDER_WINDOWS[] = { 1, 5, 30 }; //The reorder windows compared by the tests, in minutes.
+
+/**
+ * Shuffles the planes of a sorted trace so that each one arrives up to the window late: every plane is delayed by a
+ * random number of minutes from 0 to the window and the planes are then put in order of their delayed time.
+ * @param planes : The planes of the sorted trace.
+ * @param window : The largest delay, in minutes.
+ * @param seed : The seed of the delays.
+ * @return The shuffled planes, keeping their ATC IDs.
+ */
+static std::vector<Plane> shuffle(const std::vector<Plane>& planes, int window, unsigned seed) {
+
+    std::mt19937 random(seed);
+    std::vector<std::pair<int, size_t> > arrivals; //The delayed time and index of every plane
+    for (size_t i = 0; i < planes.size(); i++) {
+        arrivals.push_back(std::make_pair(planes[i].getRequestTime() + (int) (random() % (window + 1)), i));
+    }
+    std::stable_sort(arrivals.begin(), arrivals.end());
+
+    std::vector<Plane> shuffled;
+    for (size_t i = 0; i < arrivals.size(); i++) {
+        shuffled.push_back(planes[arrivals[i].second]);
+    }
+    return shuffled;
+
+}
+
+/**
+ * Compares the schedule and summary of the shuffled trace through the reorder stage with the ones of the sorted trace,
+ * for every window.
+ * @param trace : The content of the trace (unused).
+ * @param planes : The planes of the sorted trace.
+ * @param runways : The number of runways.
+ * @param expected : The summary of the Simulation class on the sorted trace.
+ * @param name : The trace and runways compared, for the messages.
+ */
+static void compareReorder(const std::string&, const std::vector<Plane>& planes, int runways,
+    const SimulationResult& expected, const std::string& name) {
+
+    ScheduleRecorder sorted;
+    Simulation reference(runways);
+    reference.setObserver(&sorted);
+    reference.run(planes.data(), planes.data() + planes.size());
+
+    for (int window : REORDER_WINDOWS) {
+
+        std::vector<Plane> shuffled = shuffle(planes, window, (unsigned) (window * 31 + runways));
+        ReorderRequestSource source(new MemoryRequestSource(shuffled.data(), shuffled.data() + shuffled.size()), window);
+
+        ScheduleRecorder reordered;
+        Simulation simulation(runways);
+        simulation.setObserver(&reordered);
+        SimulationResult actual = simulation.run(source);
+
+        std::string description = "the reorder window of " + std::to_string(window) + " minutes " + name;
+        TestSupport::expectSameResult(actual, expected, description);
+        reordered.expectSameSchedule(sorted, description);
+
+    }
+
+}
+
+/**
+ * Runs every check of this suite.
+ * @param traces : The sample trace files.
+ */
+void ReorderTest::run(const std::vector<std::string>& traces) {
+    TestSupport::compareWithSimulation(traces, compareReorder);
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+/**
+ * Cross-checks ReorderRequestSource against the Simulation class: a trace shuffled so that no request is more than the
+ * window late must give, through the reorder stage, the same schedule and summary as the sorted trace, on the sample
+ * traces and on random traces, for every number of runways (including none).
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class ReorderTest {
+
+    public:
+
+        /**
+         * Runs every check of this suite.
+         * @param traces : The sample trace files.
+         */
+        static void run(const std::vector<std::string>& traces);
+
+};
@@ -0,0 +1,68 @@
+/**
+ * This file is the implementation of the ScheduleRecorder.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "ScheduleRecorder.h"
+
+#include <algorithm>
+
+#include "TestSupport.h"
+
+/**
+ * Records one event.
+ * @param time : The time of the event.
+ * @param kind : The kind of the event.
+ * @param atcId : The ATC ID of the plane.
+ * @param runway : The runway of the plane (-1 if none).
+ */
+void ScheduleRecorder::record(int time, const char *kind, int atcId, int runway) {
+    schedule.push_back(std::to_string(time) + " " + kind + " " + std::to_string(atcId) + " " + std::to_string(runway));
+}
+
+/**
+ * Records the request event.
+ * @param event : The request event being handled.
+ */
+void ScheduleRecorder::onRequest(const RequestEvent& event) {
+    record(event.getTime(), "request", event.getPlane().getAtcId(), -1);
+}
+
+/**
+ * Records the takeoff or landing event.
+ * @param event : The takeoff or landing event being handled.
+ */
+void ScheduleRecorder::onAction(const ActionEvent& event) {
+    record(event.getTime(), "action", event.getPlane().getAtcId(), event.getRunwayID());
+}
+
+/**
+ * Records the complete event.
+ * @param event : The complete event being handled.
+ */
+void ScheduleRecorder::onComplete(const CompleteEvent& event) {
+    record(event.getTime(), "complete", event.getPlane().getAtcId(), event.getRunwayID());
+}
+
+/**
+ * Checks that this schedule is the same as the expected one, printing the first event that differs if not.
+ * @param expected : The schedule of the reference run.
+ * @param name : The runs compared, for the messages.
+ * @return true if both schedules are the same.
+ */
+bool ScheduleRecorder::expectSameSchedule(const ScheduleRecorder& expected, const std::string& name) const {
+
+    if (schedule == expected.schedule) {
+        return TestSupport::expect(true, "Schedule of " + name);
+    }
+
+    //Reports the first event that differs, or the missing or extra events at the end:
+    size_t common = std::min(schedule.size(), expected.schedule.size());
+    size_t i = std::mismatch(schedule.begin(), schedule.begin() + common, expected.schedule.begin()).first
+        - schedule.begin();
+    std::string got = i < schedule.size() ? schedule[i] : "nothing";
+    std::string wanted = i < expected.schedule.size() ? expected.schedule[i] : "nothing";
+    return TestSupport::expect(false, "Schedule of " + name + " (event " + std::to_string(i) + ": got " + got
+        + ", expected " + wanted + ")");
+
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "../SimulationObserver.h"
+
+/**
+ * Records every event handled by a simulation as one line (time, kind of event, ATC ID and runway), so that the tests
+ * can compare the whole schedule of two runs and not only their totals.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class ScheduleRecorder : public SimulationObserver {
+
+    private:
+
+        std::vector<std::string> schedule; //The events recorded so far, one line each
+
+        /**
+         * Records one event.
+         * @param time : The time of the event.
+         * @param kind : The kind of the event.
+         * @param atcId : The ATC ID of the plane.
+         * @param runway : The runway of the plane (-1 if none).
+         */
+        void record(int time, const char *kind, int atcId, int runway);
+
+    public:
+
+        /**
+         * Records the request event.
+         * @param event : The request event being handled.
+         */
+        void onRequest(const RequestEvent& event) override;
+
+        /**
+         * Records the takeoff or landing event.
+         * @param event : The takeoff or landing event being handled.
+         */
+        void onAction(const ActionEvent& event) override;
+
+        /**
+         * Records the complete event.
+         * @param event : The complete event being handled.
+         */
+        void onComplete(const CompleteEvent& event) override;
+
+        /**
+         * Checks that this schedule is the same as the expected one, printing the first event that differs if not.
+         * @param expected : The schedule of the reference run.
+         * @param name : The runs compared, for the messages.
+         * @return true if both schedules are the same.
+         */
+        bool expectSameSchedule(const ScheduleRecorder& expected, const std::string& name) const;
+
+};
@@ -0,0 +1,46 @@
+/**
+ * This file is the implementation of the SimulationCoreTest.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "SimulationCoreTest.h"
+
+#include "../SimulationCore.h"
+#include "TestSupport.h"
+
+/**
+ * Compares the summary of one SimulationCore instantiation with the summary of the Simulation class.
+ * @param planes : The planes of the trace.
+ * @param runways : The number of runways.
+ * @param expected : The summary of the Simulation class.
+ * @param name : The name of the instantiation, trace and runways, for the messages.
+ */
+template <typename Core>
+static void compareCore(const std::vector<Plane>& planes, int runways, const SimulationResult& expected,
+    const std::string& name) {
+    Core core(runways);
+    TestSupport::expectSameResult(core.run(planes.data(), planes.data() + planes.size()), expected, name);
+}
+
+/**
+ * Compares the instantiations with the Simulation class on one trace.
+ * @param trace : The content of the trace (unused).
+ * @param planes : The planes of the trace.
+ * @param runways : The number of runways.
+ * @param expected : The summary of the Simulation class.
+ * @param name : The trace and runways compared, for the messages.
+ */
+static void compareCores(const std::string&, const std::vector<Plane>& planes, int runways,
+    const SimulationResult& expected, const std::string& name) {
+    compareCore<DefaultSimulationCore>(planes, runways, expected, "DefaultSimulationCore " + name);
+    compareCore<SimulationCore<BinaryHeapQueue, LandingFirst, LowestFreeRunway> >(planes, runways, expected,
+        "SimulationCore<BinaryHeap, LandingFirst, LowestFree> " + name);
+}
+
+/**
+ * Runs every check of this suite.
+ * @param traces : The sample trace files.
+ */
+void SimulationCoreTest::run(const std::vector<std::string>& traces) {
+    TestSupport::compareWithSimulation(traces, compareCores);
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+/**
+ * Cross-checks the SimulationCore instantiations that keep the order of the Simulation class (DefaultSimulationCore and
+ * the same policies over a binary heap) against the Simulation class itself: the total wasted time, the number of
+ * requests handled and the time of the last event must be the same on the sample traces and on random traces, for every
+ * number of runways (including none).
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class SimulationCoreTest {
+
+    public:
+
+        /**
+         * Runs every check of this suite.
+         * @param traces : The sample trace files.
+         */
+        static void run(const std::vector<std::string>& traces);
+
+};
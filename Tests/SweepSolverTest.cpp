@@ -0,0 +1,57 @@
+/**
+ * This file is the implementation of the SweepSolverTest.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "SweepSolverTest.h"
+
+#include <stdexcept>
+
+#include "../SweepSolver.h"
+#include "TestSupport.h"
+
+/**
+ * Compares the total of the sweep with the total of the Simulation class on one trace.
+ * @param trace : The content of the trace.
+ * @param planes : The planes of the trace (unused, the sweep parses the trace itself).
+ * @param runways : The number of runways.
+ * @param expected : The summary of the Simulation class.
+ * @param name : The trace and runways compared, for the messages.
+ */
+static void compareSweep(const std::string& trace, const std::vector<Plane>&, int runways,
+    const SimulationResult& expected, const std::string& name) {
+    int actual = SweepSolver::solve(trace.data(), trace.data() + trace.size(), runways);
+    TestSupport::expectEqual(actual, expected.totalWastedMinutes, "SweepSolver " + name);
+}
+
+/**
+ * Checks that the sweep throws on the given trace, like the Simulation does.
+ * @param trace : The content of the trace.
+ * @param name : What is wrong with the trace, for the messages.
+ */
+static void expectRejected(const std::string& trace, const std::string& name) {
+    bool thrown = false;
+    try {
+        SweepSolver::solve(trace.data(), trace.data() + trace.size(), 1);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    TestSupport::expect(thrown, "SweepSolver rejects " + name);
+}
+
+/**
+ * Runs every check of this suite.
+ * @param traces : The sample trace files.
+ */
+void SweepSolverTest::run(const std::vector<std::string>& traces) {
+
+    TestSupport::compareWithSimulation(traces, compareSweep);
+
+    //A trace without a line break at the end is fine, an empty line is not:
+    TestSupport::compareWithSimulation("1 Delta 1243 heavy takeoff\n5 Emirates 1598 super landing",
+        "a trace without the last line break", compareSweep);
+    expectRejected("1 Delta 1243 heavy takeoff\n\n5 Emirates 1598 super landing\n", "an empty line");
+    expectRejected("1 Delta 1243 heavy takeoff\n   \n", "a blank line");
+    expectRejected("1 Delta 1243 tiny takeoff\n", "an unknown size");
+
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+/**
+ * Cross-checks SweepSolver against the Simulation class: both must give the same total wasted time on the sample
+ * traces and on random traces, for every number of runways (including none), and the sweep must reject the lines that
+ * the simulation rejects.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class SweepSolverTest {
+
+    public:
+
+        /**
+         * Runs every check of this suite.
+         * @param traces : The sample trace files.
+         */
+        static void run(const std::vector<std::string>& traces);
+
+};
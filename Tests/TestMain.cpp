@@ -0,0 +1,44 @@
+/**
+ * Runs every test suite and prints the number of checks failed. The sample trace files are given on the command line
+ * (test.txt of the working directory by default).
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "FusedModeTest.h"
+#include "ParallelLoadTest.h"
+#include "PriorityQueueTest.h"
+#include "ProcessSimulationTest.h"
+#include "ReorderTest.h"
+#include "SimulationCoreTest.h"
+#include "SweepSolverTest.h"
+#include "TestSupport.h"
+#include "TimeWarpTest.h"
+
+int main(int argc, char *argv[]) {
+
+    std::vector<std::string> traces; //The sample trace files
+    for (int i = 1; i < argc; i++) {
+        traces.push_back(argv[i]);
+    }
+    if (traces.empty()) {
+        traces.push_back("test.txt");
+    }
+
+    SweepSolverTest::run(traces);
+    SimulationCoreTest::run(traces);
+    TimeWarpTest::run(traces);
+    ProcessSimulationTest::run(traces);
+    FusedModeTest::run(traces);
+    ParallelLoadTest::run(traces);
+    ReorderTest::run(traces);
+    PriorityQueueTest::run();
+
+    printf("%d checks, %d failed\n", TestSupport::getChecks(), TestSupport::getFailures());
+    return TestSupport::getFailures() == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+
+}
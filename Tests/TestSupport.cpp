@@ -0,0 +1,171 @@
+/**
+ * This file is the implementation of the TestSupport.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "TestSupport.h"
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+#include "../Simulation.h"
+#include "../TraceLoader.h"
+
+constexpr auto MAX_TEST_RUNWAYS = 6; //The largest number of runways compared by the tests.
+constexpr auto RANDOM_TRACES = 20; //The number of random traces compared by the tests.
+constexpr auto RANDOM_TRACE_REQUESTS = 500; //The number of requests of each random trace.
+
+int TestSupport::checks = 0;
+int TestSupport::failures = 0;
+
+/**
+ * Checks a condition, printing the message onto the error stream if it does not hold.
+ * @param condition : The condition checked.
+ * @param message : What was checked.
+ * @return The condition.
+ */
+bool TestSupport::expect(bool condition, const std::string& message) {
+    checks++;
+    if (!condition) {
+        failures++;
+        std::cerr << "FAILED: " << message << std::endl;
+    }
+    return condition;
+}
+
+/**
+ * Checks that two totals are the same, printing both onto the error stream if they are not.
+ * @param actual : The total computed by the engine under test.
+ * @param expected : The total computed by the reference engine.
+ * @param message : What was compared.
+ * @return true if both are the same.
+ */
+bool TestSupport::expectEqual(long long actual, long long expected, const std::string& message) {
+    std::ostringstream details;
+    details << message << " (got " << actual << ", expected " << expected << ")";
+    return expect(actual == expected, details.str());
+}
+
+/**
+ * Checks that two summaries are the same: total wasted time, requests handled and end time.
+ * @param actual : The summary computed by the engine under test.
+ * @param expected : The summary computed by the Simulation class.
+ * @param name : The engine, trace and runways compared, for the messages.
+ */
+void TestSupport::expectSameResult(const SimulationResult& actual, const SimulationResult& expected,
+    const std::string& name) {
+    expectEqual(actual.totalWastedMinutes, expected.totalWastedMinutes, "Total wasted time of " + name);
+    expectEqual(actual.planesHandled, expected.planesHandled, "Requests handled by " + name);
+    expectEqual(actual.endTime, expected.endTime, "End time of " + name);
+}
+
+/**
+ * Runs the check on every sample trace and on random traces.
+ * @param traces : The sample trace files.
+ * @param check : The check, given the content of each trace and its name for the messages.
+ */
+void TestSupport::forEachTrace(const std::vector<std::string>& traces,
+    const std::function<void(const std::string& trace, const std::string& name)>& check) {
+
+    for (size_t i = 0; i < traces.size(); i++) {
+        check(readFile(traces[i]), traces[i]);
+    }
+
+    for (unsigned seed = 1; seed <= RANDOM_TRACES; seed++) {
+        check(randomTrace(seed, RANDOM_TRACE_REQUESTS), "random trace " + std::to_string(seed));
+    }
+
+}
+
+/**
+ * Runs the comparison on every sample trace and on random traces, for every number of runways from none to
+ * MAX_TEST_RUNWAYS.
+ * @param traces : The sample trace files.
+ * @param check : The comparison of the engine under test.
+ */
+void TestSupport::compareWithSimulation(const std::vector<std::string>& traces, const EngineCheck& check) {
+    forEachTrace(traces, [&check](const std::string& trace, const std::string& name) {
+        compareWithSimulation(trace, name, check);
+    });
+}
+
+/**
+ * Runs the comparison on one trace, for every number of runways from none to MAX_TEST_RUNWAYS.
+ * @param trace : The content of the trace.
+ * @param name : The name of the trace, for the messages.
+ * @param check : The comparison of the engine under test.
+ */
+void TestSupport::compareWithSimulation(const std::string& trace, const std::string& name, const EngineCheck& check) {
+
+    std::vector<Plane> planes = TraceLoader::parse(trace, 1);
+
+    for (int runways = 0; runways <= MAX_TEST_RUNWAYS; runways++) {
+        Simulation simulation(runways);
+        simulation.setObserver(nullptr);
+        SimulationResult expected = simulation.run(planes.data(), planes.data() + planes.size());
+        check(trace, planes, runways, expected, "on " + name + " with " + std::to_string(runways) + " runways");
+    }
+
+}
+
+/**
+ * Retrieves the number of checks made so far.
+ * @return The number of checks.
+ */
+int TestSupport::getChecks() {
+    return checks;
+}
+
+/**
+ * Retrieves the number of checks failed so far.
+ * @return The number of failures.
+ */
+int TestSupport::getFailures() {
+    return failures;
+}
+
+/**
+ * Builds a random trace in the input file format, sorted by request time. The requests come in bursts so that
+ * the runways saturate and the wait list fills up.
+ * @param seed : The seed of the trace.
+ * @param numRequests : The number of requests.
+ * @return The content of the trace.
+ */
+std::string TestSupport::randomTrace(unsigned seed, int numRequests) {
+
+    static const char *CALL_SIGNS[] = { "AirCanada", "WestJet", "Delta", "Emirates", "Porter" };
+    static const char *SIZES[] = { "small", "large", "heavy", "super" };
+
+    std::mt19937 random(seed);
+    std::ostringstream trace;
+    int time = random() % 5; //The request time of the next request
+
+    for (int i = 0; i < numRequests; i++) {
+        trace << time << " " << CALL_SIGNS[random() % 5] << " " << (int) (random() % 10000) << " "
+            << SIZES[random() % 4] << " " << (random() % 2 == 0 ? "takeoff" : "landing") << "\n";
+
+        //Mostly several requests in the same minute or the next ones, sometimes a quiet gap:
+        unsigned gap = random() % 10;
+        time += gap < 6 ? 0 : gap < 9 ? 1 : (int) (random() % 30);
+    }
+
+    return trace.str();
+
+}
+
+/**
+ * Reads a whole file into a string.
+ * @param fileName : The name of the file.
+ * @return The content of the file.
+ */
+std::string TestSupport::readFile(const std::string& fileName) {
+    std::ifstream file(fileName, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Cannot open " + fileName);
+    }
+    return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../Plane.h"
+#include "../SimulationResult.h"
+
+/**
+ * The helpers shared by every test suite: the checks, which print the failed ones and count them, and the random traces
+ * used to compare the engines with the Simulation class.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class TestSupport {
+
+    private:
+
+        static int checks; //The number of checks made so far.
+        static int failures; //The number of checks failed so far.
+
+    public:
+
+        /**
+         * Compares one engine with the Simulation class on one trace: it runs the trace with the given number of runways
+         * and checks its result against the one of a silent Simulation. Its parameters are the content of the trace, its
+         * planes, the number of runways, the summary of the Simulation and the trace and runways, for the messages.
+         */
+        typedef std::function<void(const std::string& trace, const std::vector<Plane>& planes, int runways,
+            const SimulationResult& expected, const std::string& name)> EngineCheck;
+
+        /**
+         * Checks a condition, printing the message onto the error stream if it does not hold.
+         * @param condition : The condition checked.
+         * @param message : What was checked.
+         * @return The condition.
+         */
+        static bool expect(bool condition, const std::string& message);
+
+        /**
+         * Checks that two totals are the same, printing both onto the error stream if they are not.
+         * @param actual : The total computed by the engine under test.
+         * @param expected : The total computed by the reference engine.
+         * @param message : What was compared.
+         * @return true if both are the same.
+         */
+        static bool expectEqual(long long actual, long long expected, const std::string& message);
+
+        /**
+         * Checks that two summaries are the same: total wasted time, requests handled and end time.
+         * @param actual : The summary computed by the engine under test.
+         * @param expected : The summary computed by the Simulation class.
+         * @param name : The engine, trace and runways compared, for the messages.
+         */
+        static void expectSameResult(const SimulationResult& actual, const SimulationResult& expected,
+            const std::string& name);
+
+        /**
+         * Runs the check on every sample trace and on random traces.
+         * @param traces : The sample trace files.
+         * @param check : The check, given the content of each trace and its name for the messages.
+         */
+        static void forEachTrace(const std::vector<std::string>& traces,
+            const std::function<void(const std::string& trace, const std::string& name)>& check);
+
+        /**
+         * Runs the comparison on every sample trace and on random traces, for every number of runways from none to
+         * MAX_TEST_RUNWAYS.
+         * @param traces : The sample trace files.
+         * @param check : The comparison of the engine under test.
+         */
+        static void compareWithSimulation(const std::vector<std::string>& traces, const EngineCheck& check);
+
+        /**
+         * Runs the comparison on one trace, for every number of runways from none to MAX_TEST_RUNWAYS.
+         * @param trace : The content of the trace.
+         * @param name : The name of the trace, for the messages.
+         * @param check : The comparison of the engine under test.
+         */
+        static void compareWithSimulation(const std::string& trace, const std::string& name, const EngineCheck& check);
+
+        /**
+         * Retrieves the number of checks made so far.
+         * @return The number of checks.
+         */
+        static int getChecks();
+
+        /**
+         * Retrieves the number of checks failed so far.
+         * @return The number of failures.
+         */
+        static int getFailures();
+
+        /**
+         * Builds a random trace in the input file format, sorted by request time. The requests come in bursts so that
+         * the runways saturate and the wait list fills up.
+         * @param seed : The seed of the trace.
+         * @param numRequests : The number of requests.
+         * @return The content of the trace.
+         */
+        static std::string randomTrace(unsigned seed, int numRequests);
+
+        /**
+         * Reads a whole file into a string.
+         * @param fileName : The name of the file.
+         * @return The content of the file.
+         */
+        static std::string readFile(const std::string& fileName);
+
+};
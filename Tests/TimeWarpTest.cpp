@@ -0,0 +1,37 @@
+/**
+ * This file is the implementation of the TimeWarpTest.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "TimeWarpTest.h"
+
+#include "../TimeWarpSimulation.h"
+#include "TestSupport.h"
+
+constexpr unsigned LOGICAL_PROCESSES[] = { 1, 2, 4 }; //The numbers of logical processes compared by the tests.
+
+/**
+ * Compares the total of the optimistic engine with the total of the Simulation class on one trace, for every number of
+ * logical processes.
+ * @param trace : The content of the trace (unused).
+ * @param planes : The planes of the trace.
+ * @param runways : The number of runways.
+ * @param expected : The summary of the Simulation class.
+ * @param name : The trace and runways compared, for the messages.
+ */
+static void compareTimeWarp(const std::string&, const std::vector<Plane>& planes, int runways,
+    const SimulationResult& expected, const std::string& name) {
+    for (unsigned processes : LOGICAL_PROCESSES) {
+        TimeWarpSimulation simulation(runways, processes);
+        TestSupport::expectEqual(simulation.run(planes), expected.totalWastedMinutes,
+            "TimeWarpSimulation with " + std::to_string(processes) + " logical processes " + name);
+    }
+}
+
+/**
+ * Runs every check of this suite.
+ * @param traces : The sample trace files.
+ */
+void TimeWarpTest::run(const std::vector<std::string>& traces) {
+    TestSupport::compareWithSimulation(traces, compareTimeWarp);
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+/**
+ * Cross-checks TimeWarpSimulation against the Simulation class: the optimistic engine must give the same total wasted
+ * time on the sample traces and on random traces, for every number of runways (including none) and of logical
+ * processes, whatever the rollbacks taken on the way.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class TimeWarpTest {
+
+    public:
+
+        /**
+         * Runs every check of this suite.
+         * @param traces : The sample trace files.
+         */
+        static void run(const std::vector<std::string>& traces);
+
+};
@@ -0,0 +1,313 @@
+/**
+ * This file is the implementation of the TimeWarpSimulation.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "TimeWarpSimulation.h"
+
+#include <algorithm>
+#include <thread>
+
+
+constexpr auto SNAPSHOT_INTERVAL = 16; //The minimum number of requests between two states saved by an optimistic run
+
+/**
+ * Orders the busy runways so that the one cleared first is at the top of the heap (clearance time, then landings
+ * before takeoffs, then ATC ID).
+ */
+struct LaterClearance {
+    template <typename Slot>
+    bool operator()(const Slot& slot1, const Slot& slot2) const {
+        if (slot1.freeAt != slot2.freeAt) {
+            return slot1.freeAt > slot2.freeAt;
+        }
+        if (slot1.takeoff != slot2.takeoff) {
+            return slot1.takeoff;
+        }
+        return slot1.atcId > slot2.atcId;
+    }
+};
+
+/**
+ * Orders the waiting planes the same way as the WaitList (landings first, then request time, then ATC ID).
+ */
+struct LowerPriority {
+    template <typename Waiting>
+    bool operator()(const Waiting& plane1, const Waiting& plane2) const {
+        if (plane1.takeoff != plane2.takeoff) {
+            return plane1.takeoff;
+        }
+        if (plane1.requestTime != plane2.requestTime) {
+            return plane1.requestTime > plane2.requestTime;
+        }
+        return plane1.atcId > plane2.atcId;
+    }
+};
+
+/**
+ * Builds the engine.
+ * @param numRunways : The number of runways of the airport.
+ * @param numProcesses : The number of logical processes, each one on its own thread (0 uses every core).
+ */
+TimeWarpSimulation::TimeWarpSimulation(int numRunways, unsigned numProcesses) {
+    this->numRunways = numRunways;
+    this->numProcesses = numProcesses == 0 ? std::max(1u, std::thread::hardware_concurrency()) : numProcesses;
+    gvt = 0;
+    rollbacks = 0;
+    requestsRolledBack = 0;
+}
+
+/**
+ * Computes the total wasted time of a trace.
+ * @param trace : The planes of every request, in file order (for example loaded by TraceLoader).
+ * @return The total amount of minutes wasted.
+ */
+int TimeWarpSimulation::run(const std::vector<Plane>& trace) {
+
+    gvt = 0;
+    confirmed = emptyState();
+    rollbacks = 0;
+    requestsRolledBack = 0;
+
+    //Splits the trace into one segment of consecutive requests per logical process:
+    size_t count = std::max<size_t>(1, std::min<size_t>(numProcesses, trace.size()));
+    std::vector<LogicalProcess> processes(count);
+    for (size_t i = 0; i < count; i++) {
+        processes[i].begin = trace.size() * i / count;
+        processes[i].end = trace.size() * (i + 1) / count;
+    }
+
+    //Each thread runs its segment optimistically, then waits for its turn to be confirmed:
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < count; i++) {
+        LogicalProcess *process = &processes[i];
+        threads.push_back(std::thread([this, process, &trace]() {
+            speculate(*process, trace);
+            commit(*process, trace);
+        }));
+    }
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+
+    //No more requests, every waiting plane gets the next runway that clears (without runways, they wait forever like in
+    //Simulation and never add to the total):
+    if (numRunways > 0) {
+        drain(confirmed);
+    }
+    return confirmed.wasted;
+
+}
+
+/**
+ * Runs the segment of a logical process optimistically from the empty airport, saving its state whenever the
+ * waiting line is empty (at most once every SNAPSHOT_INTERVAL requests).
+ * @param process : The logical process.
+ * @param trace : The planes of the whole trace.
+ */
+void TimeWarpSimulation::speculate(LogicalProcess& process, const std::vector<Plane>& trace) const {
+
+    State state = emptyState();
+    size_t lastSaved = process.begin; //The start is the empty airport itself, which is never saved
+
+    for (size_t i = process.begin; i < process.end; i++) {
+
+        //Only the states with an empty waiting line are saved, since a rolled back run can only catch up with the
+        //optimistic one once both lines are the same:
+        if (state.waiting.empty() && i - lastSaved >= SNAPSHOT_INTERVAL) {
+            process.snapshots.push_back(Snapshot{ i, state });
+            lastSaved = i;
+        }
+        step(state, trace[i]);
+
+    }
+
+    process.endState = state;
+
+}
+
+/**
+ * Waits for the global virtual time to reach the segment of a logical process, rolls back if the real state at
+ * its start differs from the empty airport, then confirms the segment and moves the global virtual time past it.
+ * @param process : The logical process.
+ * @param trace : The planes of the whole trace.
+ */
+void TimeWarpSimulation::commit(LogicalProcess& process, const std::vector<Plane>& trace) {
+
+    std::unique_lock<std::mutex> lock(gvtMutex);
+    gvtAdvanced.wait(lock, [this, &process]() { return gvt == process.begin; });
+
+    //Only this process can move the global virtual time now, so the lock is not needed while rolling back:
+    lock.unlock();
+
+    State state = confirmed; //The real state, starting at the beginning of the segment
+    size_t next = 0; //The next saved state that the real run can catch up with
+    size_t i = process.begin;
+    bool caughtUp = sameState(state, emptyState());
+
+    //Rolls back to the real state and simulates the requests again until it matches a saved state:
+    if (!caughtUp) {
+        rollbacks++;
+        while (i < process.end && !caughtUp) {
+            if (next < process.snapshots.size() && process.snapshots[next].index == i) {
+                caughtUp = sameState(state, process.snapshots[next].state);
+                if (caughtUp) {
+                    state.wasted -= process.snapshots[next].state.wasted;
+                    break;
+                }
+                next++;
+            }
+            step(state, trace[i++]);
+            requestsRolledBack++;
+        }
+    }
+
+    //From the state caught up with, the optimistic run is right, only the minutes wasted before differ:
+    if (caughtUp) {
+        int wasted = state.wasted + process.endState.wasted;
+        state = process.endState;
+        state.wasted = wasted;
+    }
+
+    //Fossil collection: no rollback can go back before the global virtual time anymore:
+    std::vector<Snapshot>().swap(process.snapshots);
+    process.endState = State();
+
+    lock.lock();
+    confirmed = state;
+    gvt = process.end;
+    gvtAdvanced.notify_all();
+
+}
+
+/**
+ * Handles one request: clears every runway that becomes free before it, then gives the plane a free runway or
+ * adds it to the waiting line.
+ * @param state : The state to be updated.
+ * @param plane : The plane making the request.
+ */
+void TimeWarpSimulation::step(State& state, const Plane& plane) {
+
+    WaitingPlane request = { plane.isTakeoff(), plane.getRequestTime(), plane.getAtcId(),
+        plane.getServiceTime() };
+
+    //Clears every runway that becomes free before this request, giving it to the next plane in line:
+    while (!state.busy.empty()) {
+        const BusySlot& earliest = state.busy.front();
+        bool before = earliest.freeAt != request.requestTime ? earliest.freeAt < request.requestTime
+            : earliest.takeoff != request.takeoff ? !earliest.takeoff
+            : earliest.atcId < request.atcId;
+        if (!before) {
+            break;
+        }
+        int time = earliest.freeAt;
+        std::pop_heap(state.busy.begin(), state.busy.end(), LaterClearance());
+        state.busy.pop_back();
+        if (state.waiting.empty()) {
+            state.freeRunways++;
+        } else {
+            WaitingPlane next = state.waiting.front();
+            std::pop_heap(state.waiting.begin(), state.waiting.end(), LowerPriority());
+            state.waiting.pop_back();
+            state.wasted += time - next.requestTime;
+            state.busy.push_back(BusySlot{ time + next.totalTime, next.takeoff, next.atcId });
+            std::push_heap(state.busy.begin(), state.busy.end(), LaterClearance());
+        }
+    }
+
+    //Assigns a free runway if there is one, otherwise the plane waits in line:
+    if (state.freeRunways > 0) {
+        state.freeRunways--;
+        state.busy.push_back(BusySlot{ request.requestTime + request.totalTime, request.takeoff, request.atcId });
+        std::push_heap(state.busy.begin(), state.busy.end(), LaterClearance());
+    } else {
+        state.waiting.push_back(request);
+        std::push_heap(state.waiting.begin(), state.waiting.end(), LowerPriority());
+    }
+
+}
+
+/**
+ * Gives the next runway that clears to every waiting plane, once there are no more requests. The airport must have at
+ * least one runway.
+ * @param state : The state to be drained.
+ */
+void TimeWarpSimulation::drain(State& state) {
+    while (!state.waiting.empty()) {
+        int time = state.busy.front().freeAt;
+        std::pop_heap(state.busy.begin(), state.busy.end(), LaterClearance());
+        state.busy.pop_back();
+        WaitingPlane next = state.waiting.front();
+        std::pop_heap(state.waiting.begin(), state.waiting.end(), LowerPriority());
+        state.waiting.pop_back();
+        state.wasted += time - next.requestTime;
+        state.busy.push_back(BusySlot{ time + next.totalTime, next.takeoff, next.atcId });
+        std::push_heap(state.busy.begin(), state.busy.end(), LaterClearance());
+    }
+}
+
+/**
+ * Checks if two states will waste the same minutes from now on, whatever the minutes wasted so far.
+ * @param state1 : The first state.
+ * @param state2 : The second state.
+ * @return true if both have the same busy runways, waiting planes and free runways.
+ */
+bool TimeWarpSimulation::sameState(const State& state1, const State& state2) {
+
+    if (state1.freeRunways != state2.freeRunways || state1.busy.size() != state2.busy.size()
+        || state1.waiting.size() != state2.waiting.size()) {
+        return false;
+    }
+
+    //The heaps may hold the same elements in a different layout, so they are compared once sorted:
+    std::vector<BusySlot> busy1 = state1.busy;
+    std::vector<BusySlot> busy2 = state2.busy;
+    std::sort(busy1.begin(), busy1.end(), LaterClearance());
+    std::sort(busy2.begin(), busy2.end(), LaterClearance());
+    for (size_t i = 0; i < busy1.size(); i++) {
+        if (busy1[i].freeAt != busy2[i].freeAt || busy1[i].takeoff != busy2[i].takeoff
+            || busy1[i].atcId != busy2[i].atcId) {
+            return false;
+        }
+    }
+
+    std::vector<WaitingPlane> waiting1 = state1.waiting;
+    std::vector<WaitingPlane> waiting2 = state2.waiting;
+    std::sort(waiting1.begin(), waiting1.end(), LowerPriority());
+    std::sort(waiting2.begin(), waiting2.end(), LowerPriority());
+    for (size_t i = 0; i < waiting1.size(); i++) {
+        if (waiting1[i].atcId != waiting2[i].atcId) {
+            return false;
+        }
+    }
+
+    return true;
+
+}
+
+/**
+ * Builds the state of the empty airport, which every optimistic run starts from.
+ * @return The state with every runway free.
+ */
+TimeWarpSimulation::State TimeWarpSimulation::emptyState() const {
+    State state;
+    state.freeRunways = numRunways;
+    state.wasted = 0;
+    return state;
+}
+
+/**
+ * Returns the number of logical processes that had to roll back during the last run.
+ * @return The number of rollbacks.
+ */
+int TimeWarpSimulation::getRollbacks() const {
+    return rollbacks;
+}
+
+/**
+ * Returns the number of requests simulated again because of the rollbacks during the last run.
+ * @return The number of requests rolled back.
+ */
+size_t TimeWarpSimulation::getRequestsRolledBack() const {
+    return requestsRolledBack;
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include "Plane.h"
+
+/**
+ * An optimistic parallel engine (Time Warp) computing the total wasted time of a trace. The runways of the airport share
+ * one waiting line, so they cannot be simulated apart; the logical processes are consecutive segments of the trace
+ * instead, each one running on its own thread.
+ *
+ * Every logical process first simulates its segment optimistically, assuming that the airport is empty when its first
+ * request comes in. It saves its state now and then along the way, whenever its waiting line is empty. Once the process
+ * before it is confirmed, the real state at the start of the segment arrives like a straggler message: if it is not the
+ * empty airport that was assumed, the process rolls back to it and simulates its requests again, until its state matches
+ * one of the saved states. From there the rest of the optimistic run is right, so its result is kept and only adjusted
+ * by the minutes wasted before that point.
+ *
+ * The global virtual time (GVT) is the first request not confirmed yet. Every state saved before it can never be rolled
+ * back to, so it is dropped (fossil collection) as soon as the process is confirmed.
+ *
+ * The busy runways and the waiting planes are ordered the same way as in SweepSolver, so the total wasted time is the same
+ * as Simulation::getTotalWastedMinutes() for the same trace and number of runways.
+ *
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class TimeWarpSimulation {
+
+    private:
+
+        /**
+         * A busy runway: only the clearance time and the plane on it matter for the total wasted time.
+         */
+        struct BusySlot {
+            int freeAt; //The time when the runway is cleared.
+            bool takeoff; //Whether the plane on this runway is taking off.
+            int atcId; //The ATC ID of the plane on this runway.
+        };
+
+        /**
+         * A plane waiting in line for a runway.
+         */
+        struct WaitingPlane {
+            bool takeoff; //Whether the plane is requesting a takeoff.
+            int requestTime; //The time when the plane made its request.
+            int atcId; //The ATC ID of the plane.
+            int totalTime; //The time that the plane will occupy the runway.
+        };
+
+        /**
+         * The state of the airport right before a request is handled.
+         */
+        struct State {
+            std::vector<BusySlot> busy; //The busy runways, as a heap with the first one cleared on top
+            std::vector<WaitingPlane> waiting; //The waiting line, as a heap with the next plane on top
+            int freeRunways; //The number of free runways
+            int wasted; //The minutes wasted so far by this run
+        };
+
+        /**
+         * A state saved by the optimistic run of a logical process.
+         */
+        struct Snapshot {
+            size_t index; //The index of the next request in the trace
+            State state; //The state right before this request
+        };
+
+        /**
+         * A logical process: one segment of the trace with its optimistic run.
+         */
+        struct LogicalProcess {
+            size_t begin; //The index of the first request of the segment
+            size_t end; //One past the index of the last request of the segment
+            std::vector<Snapshot> snapshots; //The states saved by the optimistic run, in request order
+            State endState; //The state after the last request of the optimistic run
+        };
+
+        int numRunways; //The number of runways of the airport.
+        unsigned numProcesses; //The number of logical processes (and threads).
+        size_t gvt; //The global virtual time: the index of the first request not confirmed yet.
+        State confirmed; //The confirmed state at the global virtual time.
+        std::mutex gvtMutex; //Guards the global virtual time and the confirmed state.
+        std::condition_variable gvtAdvanced; //Notified every time the global virtual time moves forward.
+        int rollbacks; //The number of logical processes that had to roll back.
+        size_t requestsRolledBack; //The number of requests simulated again because of the rollbacks.
+
+        /**
+         * Handles one request: clears every runway that becomes free before it, then gives the plane a free runway or
+         * adds it to the waiting line.
+         * @param state : The state to be updated.
+         * @param plane : The plane making the request.
+         */
+        static void step(State& state, const Plane& plane);
+
+        /**
+         * Gives the next runway that clears to every waiting plane, once there are no more requests. The airport must have at
+         * least one runway.
+         * @param state : The state to be drained.
+         */
+        static void drain(State& state);
+
+        /**
+         * Checks if two states will waste the same minutes from now on, whatever the minutes wasted so far.
+         * @param state1 : The first state.
+         * @param state2 : The second state.
+         * @return true if both have the same busy runways, waiting planes and free runways.
+         */
+        static bool sameState(const State& state1, const State& state2);
+
+        /**
+         * Builds the state of the empty airport, which every optimistic run starts from.
+         * @return The state with every runway free.
+         */
+        State emptyState() const;
+
+        /**
+         * Runs the segment of a logical process optimistically from the empty airport, saving its state whenever the
+         * waiting line is empty (at most once every SNAPSHOT_INTERVAL requests).
+         * @param process : The logical process.
+         * @param trace : The planes of the whole trace.
+         */
+        void speculate(LogicalProcess& process, const std::vector<Plane>& trace) const;
+
+        /**
+         * Waits for the global virtual time to reach the segment of a logical process, rolls back if the real state at
+         * its start differs from the empty airport, then confirms the segment and moves the global virtual time past it.
+         * @param process : The logical process.
+         * @param trace : The planes of the whole trace.
+         */
+        void commit(LogicalProcess& process, const std::vector<Plane>& trace);
+
+    public:
+
+        /**
+         * Builds the engine.
+         * @param numRunways : The number of runways of the airport.
+         * @param numProcesses : The number of logical processes, each one on its own thread (0 uses every core).
+         */
+        TimeWarpSimulation(int numRunways, unsigned numProcesses = 0);
+
+        /**
+         * Computes the total wasted time of a trace.
+         * @param trace : The planes of every request, in file order (for example loaded by TraceLoader).
+         * @return The total amount of minutes wasted.
+         */
+        int run(const std::vector<Plane>& trace);
+
+        /**
+         * Returns the number of logical processes that had to roll back during the last run.
+         * @return The number of rollbacks.
+         */
+        int getRollbacks() const;
+
+        /**
+         * Returns the number of requests simulated again because of the rollbacks during the last run.
+         * @return The number of requests rolled back.
+         */
+        size_t getRequestsRolledBack() const;
+
+};
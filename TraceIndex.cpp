@@ -0,0 +1,197 @@
+/**
+ * This file is the implementation of the TraceIndex.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "TraceIndex.h"
+
+#include <cstdlib>
+#include <stdexcept>
+
+#include "BinaryIO.h"
+
+constexpr auto INDEX_MAGIC = 0x58445441; //"ATDX" in little endian, marks the index files
+constexpr auto INDEX_VERSION = 2; //The version of the index format (2 added the modification time of the file)
+
+/**
+ * Computes the bucket of the given time, rounding down for the negative times too.
+ * @param time : The request time.
+ * @param bucketSize : The number of minutes covered by each bucket.
+ * @return The number of the bucket.
+ */
+static int bucketOf(int time, int bucketSize) {
+    return (time >= 0) ? time / bucketSize : -((-time + bucketSize - 1) / bucketSize);
+}
+
+/**
+ * Constructs an empty index.
+ * @param bucketSize : The number of minutes covered by each bucket.
+ */
+TraceIndex::TraceIndex(int bucketSize) {
+    if (bucketSize <= 0) {
+        throw std::invalid_argument("The bucket size must be positive");
+    }
+    this->bucketSize = bucketSize;
+    endOffset = 0;
+    endId = 1;
+}
+
+/**
+ * Builds the index of the given input file in a single pass. Only the request time of each line is parsed.
+ * @param fileName : The name of the input file, sorted by request time.
+ */
+void TraceIndex::build(const std::string& fileName) {
+
+    std::ifstream inputFile(fileName, std::ios::binary);
+    if (!inputFile) {
+        throw std::runtime_error("Cannot open " + fileName);
+    }
+
+    //Stamps the file before reading it, so that a change made during the pass makes the index out of date:
+    stamp = FileStamp::of(fileName);
+
+    std::string line; //The line read from the file
+    std::streamoff offset = 0; //The byte offset of this line
+    int atcId = 1; //The ATC ID of the request on this line
+    int previousTime = 0; //The request time of the previous line
+
+    buckets.clear();
+    while (std::getline(inputFile, line)) {
+
+        int time = (int) std::strtol(line.c_str(), nullptr, 10);
+        if (atcId > 1 && time < previousTime) {
+            throw std::runtime_error(fileName + " is not sorted by request time (see --sort), line " + std::to_string(atcId));
+        }
+
+        //Records the first request of every bucket:
+        int bucket = bucketOf(time, bucketSize);
+        if (buckets.empty() || buckets.back().bucket != bucket) {
+            buckets.push_back(Bucket{ bucket, offset, atcId });
+        }
+
+        previousTime = time;
+        offset += line.size() + (inputFile.eof() ? 0 : 1);
+        atcId++;
+
+    }
+
+    endOffset = offset;
+    endId = atcId;
+
+}
+
+/**
+ * Opens the index of the given input file: reads "[fileName].idx" if it is up to date, otherwise builds it and saves
+ * it there for the next runs.
+ * @param fileName : The name of the input file, sorted by request time.
+ * @param bucketSize : The number of minutes covered by each bucket of a new index.
+ * @return The index of this file.
+ */
+TraceIndex TraceIndex::open(const std::string& fileName, int bucketSize) {
+
+    TraceIndex index(bucketSize);
+    std::string indexName = fileName + ".idx";
+    if (!index.load(indexName, FileStamp::of(fileName))) {
+        index.build(fileName);
+        index.save(indexName);
+    }
+    return index;
+
+}
+
+/**
+ * Reads the index saved for the given input file.
+ * @param indexName : The name of the index file.
+ * @param stamp : The current size and modification time of the input file.
+ * @return true if the index was read and matches the input file, false otherwise.
+ */
+bool TraceIndex::load(const std::string& indexName, const FileStamp& stamp) {
+
+    std::ifstream in(indexName, std::ios::binary);
+
+    try {
+
+        if (!in || BinaryIO::readInt(in) != INDEX_MAGIC || BinaryIO::readInt(in) != INDEX_VERSION
+            || BinaryIO::readLong(in) != stamp.getSize() || BinaryIO::readLong(in) != stamp.getModified()) {
+            return false;
+        }
+
+        bucketSize = BinaryIO::readInt(in);
+        this->stamp = stamp;
+        endOffset = BinaryIO::readLong(in);
+        endId = BinaryIO::readInt(in);
+
+        int count = BinaryIO::readInt(in); //The number of buckets
+        buckets.clear();
+        for (int i = 0; i < count; i++) {
+            Bucket entry;
+            entry.bucket = BinaryIO::readInt(in);
+            entry.offset = BinaryIO::readLong(in);
+            entry.atcId = BinaryIO::readInt(in);
+            buckets.push_back(entry);
+        }
+        return true;
+
+    } catch (const std::runtime_error&) {
+        //A truncated index is simply built again:
+        return false;
+    }
+
+}
+
+/**
+ * Writes this index into the given file.
+ * @param indexName : The name of the index file.
+ */
+void TraceIndex::save(const std::string& indexName) const {
+
+    std::ofstream out(indexName, std::ios::binary | std::ios::trunc);
+    BinaryIO::writeInt(out, INDEX_MAGIC);
+    BinaryIO::writeInt(out, INDEX_VERSION);
+    BinaryIO::writeLong(out, stamp.getSize());
+    BinaryIO::writeLong(out, stamp.getModified());
+    BinaryIO::writeInt(out, bucketSize);
+    BinaryIO::writeLong(out, endOffset);
+    BinaryIO::writeInt(out, endId);
+    BinaryIO::writeInt(out, (int) buckets.size());
+    for (size_t i = 0; i < buckets.size(); i++) {
+        BinaryIO::writeInt(out, buckets[i].bucket);
+        BinaryIO::writeLong(out, buckets[i].offset);
+        BinaryIO::writeInt(out, buckets[i].atcId);
+    }
+
+}
+
+/**
+ * Finds where to start reading the input file so that no request made at or after the given time is missed. Only
+ * the requests of the bucket of this time that come before it are read needlessly.
+ * @param time : The earliest request time wanted.
+ * @param offset : Receives the byte offset of the line to start from.
+ * @param atcId : Receives the ATC ID of the request on that line.
+ */
+void TraceIndex::seek(int time, std::streamoff& offset, int& atcId) const {
+
+    int bucket = bucketOf(time, bucketSize); //The bucket of this time
+    size_t low = 0; //Binary search for the first non-empty bucket at or after this one
+    size_t high = buckets.size();
+
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (buckets[middle].bucket < bucket) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    //Every request is earlier than this time: starts past the last line:
+    if (low == buckets.size()) {
+        offset = endOffset;
+        atcId = endId;
+        return;
+    }
+
+    offset = buckets[low].offset;
+    atcId = buckets[low].atcId;
+
+}
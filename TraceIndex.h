@@ -0,0 +1,87 @@
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "FileStamp.h"
+
+constexpr auto DEFAULT_BUCKET_SIZE = 60; //The default number of minutes covered by each bucket of a TraceIndex.
+
+/**
+ * A sidecar index of an input file sorted by request time (see TraceSorter), so that a simulation can start reading in
+ * the middle of the file instead of parsing it from the first line. The requests are grouped into buckets of a fixed
+ * number of minutes, and the index keeps the byte offset and the ATC ID (line number) of the first request of every
+ * bucket.
+ *
+ * The index is built in a single pass over the file and saved next to it as "[fileName].idx" (see BinaryIO). It is built
+ * again whenever the size or the modification time of the input file no longer matches the ones it was built for.
+ *
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class TraceIndex {
+
+    private:
+
+        /**
+         * The first request of one bucket.
+         */
+        struct Bucket {
+            int bucket; //The number of the bucket (request time divided by the bucket size).
+            std::streamoff offset; //The byte offset of the line of this request.
+            int atcId; //The ATC ID of this request.
+        };
+
+        int bucketSize; //The number of minutes covered by each bucket.
+        FileStamp stamp; //The size and modification time of the input file indexed.
+        std::streamoff endOffset; //The byte offset past the last complete line indexed.
+        int endId; //The ATC ID that the request after the last one would be given.
+        std::vector<Bucket> buckets; //The first request of every non-empty bucket, in file order.
+
+        /**
+         * Reads the index saved for the given input file.
+         * @param indexName : The name of the index file.
+         * @param stamp : The current size and modification time of the input file.
+         * @return true if the index was read and matches the input file, false otherwise.
+         */
+        bool load(const std::string& indexName, const FileStamp& stamp);
+
+        /**
+         * Writes this index into the given file.
+         * @param indexName : The name of the index file.
+         */
+        void save(const std::string& indexName) const;
+
+    public:
+
+        /**
+         * Constructs an empty index.
+         * @param bucketSize : The number of minutes covered by each bucket.
+         */
+        TraceIndex(int bucketSize = DEFAULT_BUCKET_SIZE);
+
+        /**
+         * Builds the index of the given input file in a single pass. Only the request time of each line is parsed.
+         * @param fileName : The name of the input file, sorted by request time.
+         */
+        void build(const std::string& fileName);
+
+        /**
+         * Opens the index of the given input file: reads "[fileName].idx" if it is up to date, otherwise builds it and saves
+         * it there for the next runs.
+         * @param fileName : The name of the input file, sorted by request time.
+         * @param bucketSize : The number of minutes covered by each bucket of a new index.
+         * @return The index of this file.
+         */
+        static TraceIndex open(const std::string& fileName, int bucketSize = DEFAULT_BUCKET_SIZE);
+
+        /**
+         * Finds where to start reading the input file so that no request made at or after the given time is missed. Only
+         * the requests of the bucket of this time that come before it are read needlessly.
+         * @param time : The earliest request time wanted.
+         * @param offset : Receives the byte offset of the line to start from.
+         * @param atcId : Receives the ATC ID of the request on that line.
+         */
+        void seek(int time, std::streamoff& offset, int& atcId) const;
+
+};
@@ -0,0 +1,138 @@
+/**
+ * This file is the implementation of the TraceLoader.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "TraceLoader.h"
+
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <thread>
+
+constexpr auto MIN_CHUNK_SIZE = 1 << 16; //The smallest chunk worth giving to a thread (in bytes).
+
+/**
+ * Counts the lines of the chunk [begin, end) the same way as std::getline would read them.
+ * @param buffer : The content of the input file.
+ * @param begin : The start of the chunk.
+ * @param end : One past the end of the chunk.
+ * @return The number of lines in this chunk.
+ */
+static size_t countLines(const std::string& buffer, size_t begin, size_t end) {
+    size_t lines = std::count(buffer.begin() + begin, buffer.begin() + end, '\n');
+    if (end > begin && buffer[end - 1] != '\n') {
+        lines++;
+    }
+    return lines;
+}
+
+/**
+ * Parses every line of the chunk [begin, end) into the planes starting at the given position.
+ * @param buffer : The content of the input file.
+ * @param begin : The start of the chunk.
+ * @param end : One past the end of the chunk.
+ * @param planes : The storage receiving the planes.
+ * @param first : The position of the first plane of this chunk (its ATC ID is firstId + first).
+ * @param firstId : The ATC ID of the first request of the whole buffer.
+ */
+static void parseChunk(const std::string& buffer, size_t begin, size_t end, std::vector<Plane>& planes, size_t first, int firstId) {
+    size_t position = first; //The position of the next plane
+    while (begin < end) {
+        size_t lineEnd = buffer.find('\n', begin);
+        if (lineEnd == std::string::npos || lineEnd > end) {
+            lineEnd = end;
+        }
+        planes[position] = Plane::parse(buffer.substr(begin, lineEnd - begin), firstId + (int) position);
+        position++;
+        begin = lineEnd + 1;
+    }
+}
+
+/**
+ * Loads and parses every request of the input file, in file order.
+ * @param fileName : The name of the input file.
+ * @param numThreads : The number of threads parsing the file (0 uses every core).
+ * @return The planes of every request, with ATC IDs from 1 in file order.
+ */
+std::vector<Plane> TraceLoader::load(const std::string& fileName, unsigned numThreads) {
+
+    //Reads the file in a single pass into one buffer:
+    std::ifstream inputFile(fileName, std::ios::binary);
+    std::string buffer((std::istreambuf_iterator<char>(inputFile)), std::istreambuf_iterator<char>());
+
+    return parse(buffer, numThreads);
+
+}
+
+/**
+ * Parses every request of the given buffer, in order. The buffer uses the same format as the input file.
+ * @param buffer : The content of the input file.
+ * @param numThreads : The number of threads parsing the buffer (0 uses every core).
+ * @param firstId : The ATC ID of the first request.
+ * @return The planes of every request, with consecutive ATC IDs starting at firstId.
+ */
+std::vector<Plane> TraceLoader::parse(const std::string& buffer, unsigned numThreads, int firstId) {
+
+    //Uses every core by default, but never gives a thread less than a minimum chunk:
+    if (numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    numThreads = (unsigned) std::min<size_t>(numThreads, buffer.size() / MIN_CHUNK_SIZE + 1);
+
+    //Splits the buffer at the line break following each even split point:
+    std::vector<size_t> bounds(numThreads + 1, buffer.size());
+    bounds[0] = 0;
+    for (unsigned i = 1; i < numThreads; i++) {
+        size_t split = std::max(bounds[i - 1], buffer.size() / numThreads * i);
+        size_t lineBreak = buffer.find('\n', split);
+        bounds[i] = (lineBreak == std::string::npos) ? buffer.size() : lineBreak + 1;
+    }
+
+    std::vector<size_t> firsts(numThreads + 1, 0); //The position of the first plane of each chunk
+    std::vector<std::exception_ptr> errors(numThreads); //The error raised by each thread (if any)
+    std::vector<std::thread> threads; //The parsing threads
+    std::vector<Plane> planes; //The planes of every request
+
+    //First pass: each thread counts the lines of its chunk:
+    for (unsigned i = 0; i < numThreads; i++) {
+        threads.push_back(std::thread([&buffer, &bounds, &firsts, i]() {
+            firsts[i + 1] = countLines(buffer, bounds[i], bounds[i + 1]);
+        }));
+    }
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+    threads.clear();
+
+    //Prefix sum of the line counts: the first plane of each chunk comes right after every line of the previous chunks:
+    for (unsigned i = 0; i < numThreads; i++) {
+        firsts[i + 1] += firsts[i];
+    }
+    planes.resize(firsts[numThreads]);
+
+    //Second pass: each thread parses its chunk right into its own part of the planes:
+    for (unsigned i = 0; i < numThreads; i++) {
+        threads.push_back(std::thread([&buffer, &bounds, &firsts, &planes, &errors, firstId, i]() {
+            try {
+                parseChunk(buffer, bounds[i], bounds[i + 1], planes, firsts[i], firstId);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }));
+    }
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+
+    //Reports the error of the earliest chunk, as a sequential parse would have:
+    for (unsigned i = 0; i < numThreads; i++) {
+        if (errors[i]) {
+            std::rethrow_exception(errors[i]);
+        }
+    }
+
+    return planes;
+
+}
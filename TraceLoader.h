@@ -0,0 +1,35 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Plane.h"
+
+/**
+ * Loads a whole input file into memory in one pass, parsing it on several threads. The file is split into one chunk per
+ * thread at line boundaries. Each thread first counts the lines of its chunk, then the ATC IDs of each chunk are given by
+ * a prefix sum over these counts, so every plane gets the same ATC ID as with a sequential parse.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class TraceLoader {
+
+    public:
+
+        /**
+         * Loads and parses every request of the input file, in file order.
+         * @param fileName : The name of the input file.
+         * @param numThreads : The number of threads parsing the file (0 uses every core).
+         * @return The planes of every request, with ATC IDs from 1 in file order.
+         */
+        static std::vector<Plane> load(const std::string& fileName, unsigned numThreads = 0);
+
+        /**
+         * Parses every request of the given buffer, in order. The buffer uses the same format as the input file.
+         * @param buffer : The content of the input file.
+         * @param numThreads : The number of threads parsing the buffer (0 uses every core).
+         * @param firstId : The ATC ID of the first request.
+         * @return The planes of every request, with consecutive ATC IDs starting at firstId.
+         */
+        static std::vector<Plane> parse(const std::string& buffer, unsigned numThreads = 0, int firstId = 1);
+
+};
@@ -0,0 +1,276 @@
+/**
+ * This file is the implementation of the TraceSorter.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "TraceSorter.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+
+/**
+ * Orders two records by time, then by their position in the input file.
+ * @param record1 : first record
+ * @param record2 : second record
+ * @return true if the first record comes before the second one.
+ */
+template <typename R>
+static bool recordBefore(const R& record1, const R& record2) {
+    if (record1.time != record2.time) {
+        return record1.time < record2.time;
+    }
+    return record1.order < record2.order;
+}
+
+/**
+ * Constructs a sorter with the given memory budget.
+ * @param memoryMegabytes : The memory budget of the sort (in megabytes), which must be positive.
+ * @param numThreads : The number of threads sorting in memory (0 uses every core).
+ * @throws std::invalid_argument if the memory budget is not positive.
+ */
+TraceSorter::TraceSorter(long memoryMegabytes, unsigned numThreads) {
+    if (memoryMegabytes <= 0) {
+        throw std::invalid_argument("The memory budget of the sort must be a positive number of megabytes");
+    }
+    this->memoryLimit = (size_t) memoryMegabytes * 1024 * 1024;
+    this->numThreads = (numThreads == 0) ? std::max(1u, std::thread::hardware_concurrency()) : numThreads;
+}
+
+/**
+ * Deletes the given files, ignoring the ones that do not exist (anymore).
+ * @param files : The names of the files.
+ */
+void TraceSorter::removeFiles(const std::vector<std::string>& files) {
+    for (size_t i = 0; i < files.size(); i++) {
+        std::remove(files[i].c_str());
+    }
+}
+
+/**
+ * Reads the request time at the start of a line.
+ * @param line : The line of the input file.
+ * @return The request time of this line.
+ */
+int TraceSorter::readTime(const std::string& line) {
+    return std::stoi(line);
+}
+
+/**
+ * Sorts the records by time then input order, on several threads.
+ * @param records : The records to be sorted.
+ */
+void TraceSorter::sortRecords(std::vector<Record>& records) const {
+
+    size_t parts = std::max<size_t>(1, std::min<size_t>(numThreads, records.size() / 1024)); //The number of parts
+    std::vector<size_t> bounds(parts + 1); //The start of each part
+    std::vector<std::thread> threads; //The sorting threads
+
+    for (size_t i = 0; i <= parts; i++) {
+        bounds[i] = records.size() / parts * i;
+    }
+    bounds[parts] = records.size();
+
+    //Sorts each part on its own thread:
+    for (size_t i = 0; i < parts; i++) {
+        threads.push_back(std::thread([&records, &bounds, i]() {
+            std::sort(records.begin() + bounds[i], records.begin() + bounds[i + 1], recordBefore<Record>);
+        }));
+    }
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+
+    //Merges neighbouring parts two by two, each pair on its own thread, until one part is left:
+    for (size_t width = 1; width < parts; width *= 2) {
+        threads.clear();
+        for (size_t i = 0; i + width < parts; i += 2 * width) {
+            size_t first = bounds[i];
+            size_t middle = bounds[i + width];
+            size_t last = bounds[std::min(i + 2 * width, parts)];
+            threads.push_back(std::thread([&records, first, middle, last]() {
+                std::inplace_merge(records.begin() + first, records.begin() + middle, records.begin() + last,
+                    recordBefore<Record>);
+            }));
+        }
+        for (size_t i = 0; i < threads.size(); i++) {
+            threads[i].join();
+        }
+    }
+
+}
+
+/**
+ * Writes the records, in order, as lines of the given file.
+ * @param records : The records to be written.
+ * @param fileName : The file to be written.
+ */
+void TraceSorter::writeRecords(const std::vector<Record>& records, const std::string& fileName) {
+
+    std::ofstream output(fileName, std::ios::binary);
+    if (!output) {
+        throw std::runtime_error("Cannot write " + fileName);
+    }
+
+    for (size_t i = 0; i < records.size(); i++) {
+        output << records[i].line << '\n';
+    }
+
+}
+
+/**
+ * Merges sorted files into one sorted file. For lines with the same time, the lines of an earlier file come first.
+ * @param runs : The sorted files, in input order.
+ * @param fileName : The merged file to be written.
+ */
+void TraceSorter::mergeRuns(const std::vector<std::string>& runs, const std::string& fileName) {
+
+    /**
+     * The current line of one run. The run index plays the part of the input order since runs are cut in input order.
+     */
+    struct Head {
+        int time; //The request time of the line.
+        size_t order; //The index of the run holding the line.
+        std::string line; //The line itself.
+    };
+
+    /**
+     * Orders the heap so that the first line to be written is at the top.
+     */
+    struct Later {
+        bool operator()(const Head& head1, const Head& head2) const {
+            return recordBefore(head2, head1);
+        }
+    };
+
+    std::vector<std::ifstream *> inputs; //The opened runs
+    std::priority_queue<Head, std::vector<Head>, Later> heads; //The current line of each run
+    std::ofstream output(fileName, std::ios::binary);
+    Head head;
+
+    if (!output) {
+        throw std::runtime_error("Cannot write " + fileName);
+    }
+
+    try {
+
+        //Opens every run and reads its first line:
+        for (size_t i = 0; i < runs.size(); i++) {
+            inputs.push_back(new std::ifstream(runs[i], std::ios::binary));
+            if (std::getline(*inputs[i], head.line)) {
+                head.time = readTime(head.line);
+                head.order = i;
+                heads.push(head);
+            }
+        }
+
+        //Writes the earliest line, then replaces it with the next line of the same run:
+        while (!heads.empty()) {
+            head = heads.top();
+            heads.pop();
+            output << head.line << '\n';
+            if (std::getline(*inputs[head.order], head.line)) {
+                head.time = readTime(head.line);
+                heads.push(head);
+            }
+        }
+
+    } catch (...) {
+        for (size_t i = 0; i < inputs.size(); i++) {
+            delete inputs[i];
+        }
+        throw;
+    }
+
+    for (size_t i = 0; i < inputs.size(); i++) {
+        delete inputs[i];
+    }
+
+}
+
+/**
+ * Sorts the input file into the output file.
+ * @param inputFile : The name of the file to be sorted.
+ * @param outputFile : The name of the sorted file to be written.
+ */
+void TraceSorter::sort(const std::string& inputFile, const std::string& outputFile) const {
+
+    std::ifstream input(inputFile, std::ios::binary);
+    std::vector<Record> records; //The records of the current run
+    std::vector<std::string> runs; //The sorted runs written so far
+    std::vector<std::string> temporary; //Every temporary file written so far, deleted at the end
+    size_t used = 0; //The memory used by the current run (estimated)
+    Record record;
+
+    if (!input) {
+        throw std::runtime_error("Cannot open " + inputFile);
+    }
+
+    try {
+
+        //Reads the file, cutting it into sorted runs whenever the memory budget is reached:
+        record.order = 0;
+        while (std::getline(input, record.line)) {
+
+            if (record.line.empty()) {
+                continue;
+            }
+
+            record.time = readTime(record.line);
+            used += sizeof(Record) + record.line.size();
+            records.push_back(record);
+            record.order++;
+
+            if (used >= memoryLimit) {
+                runs.push_back(outputFile + ".run" + std::to_string(runs.size()));
+                temporary.push_back(runs.back());
+                sortRecords(records);
+                writeRecords(records, runs.back());
+                records.clear();
+                used = 0;
+            }
+
+        }
+
+        //The whole file fits in memory: sorts it and writes it directly:
+        if (runs.empty()) {
+            sortRecords(records);
+            writeRecords(records, outputFile);
+            return;
+        }
+
+        //Writes the last run, then frees the memory before merging:
+        if (!records.empty()) {
+            runs.push_back(outputFile + ".run" + std::to_string(runs.size()));
+            temporary.push_back(runs.back());
+            sortRecords(records);
+            writeRecords(records, runs.back());
+        }
+        std::vector<Record>().swap(records);
+
+        //Merges the runs by groups until few enough are left to be merged at once:
+        for (int pass = 0; runs.size() > MAX_MERGE_WAYS; pass++) {
+            std::vector<std::string> merged; //The runs of the next pass
+            for (size_t i = 0; i < runs.size(); i += MAX_MERGE_WAYS) {
+                std::vector<std::string> group(runs.begin() + i, runs.begin() + std::min<size_t>(i + MAX_MERGE_WAYS, runs.size()));
+                merged.push_back(outputFile + ".pass" + std::to_string(pass) + "." + std::to_string(merged.size()));
+                temporary.push_back(merged.back());
+                mergeRuns(group, merged.back());
+                removeFiles(group);
+            }
+            runs = merged;
+        }
+
+        mergeRuns(runs, outputFile);
+
+    } catch (...) {
+        removeFiles(temporary);
+        throw;
+    }
+
+    removeFiles(temporary);
+
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+constexpr auto DEFAULT_SORT_MEMORY = 1024; //The default memory budget of the sort (in megabytes).
+constexpr auto MAX_MERGE_WAYS = 64; //The maximum number of sorted runs merged at once.
+
+/**
+ * Sorts an input file by request time, keeping the input order between requests made at the same time, and writes it
+ * back as a new input file ready for the simulation.
+ *
+ * When the file fits in the memory budget, it is sorted in memory on every core. Otherwise the file is cut into runs that
+ * fit in the budget, each run is sorted in memory and written to a temporary file, and the runs are then merged with a
+ * k-way merge (at most MAX_MERGE_WAYS at once, in several passes if needed), so the memory used stays bounded whatever
+ * the size of the file.
+ *
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class TraceSorter {
+
+    private:
+
+        /**
+         * One line of the input file with its sort key.
+         */
+        struct Record {
+            int time; //The request time of this line.
+            size_t order; //The position of this line in the input file.
+            std::string line; //The line itself.
+        };
+
+        size_t memoryLimit; //The memory budget of the sort (in bytes).
+        unsigned numThreads; //The number of threads sorting in memory.
+
+        /**
+         * Sorts the records by time then input order, on several threads.
+         * @param records : The records to be sorted.
+         */
+        void sortRecords(std::vector<Record>& records) const;
+
+        /**
+         * Writes the records, in order, as lines of the given file.
+         * @param records : The records to be written.
+         * @param fileName : The file to be written.
+         */
+        static void writeRecords(const std::vector<Record>& records, const std::string& fileName);
+
+        /**
+         * Merges sorted files into one sorted file. For lines with the same time, the lines of an earlier file come first.
+         * @param runs : The sorted files, in input order.
+         * @param fileName : The merged file to be written.
+         */
+        static void mergeRuns(const std::vector<std::string>& runs, const std::string& fileName);
+
+        /**
+         * Deletes the given files, ignoring the ones that do not exist (anymore).
+         * @param files : The names of the files.
+         */
+        static void removeFiles(const std::vector<std::string>& files);
+
+        /**
+         * Reads the request time at the start of a line.
+         * @param line : The line of the input file.
+         * @return The request time of this line.
+         */
+        static int readTime(const std::string& line);
+
+    public:
+
+        /**
+         * Constructs a sorter with the given memory budget.
+         * @param memoryMegabytes : The memory budget of the sort (in megabytes), which must be positive.
+         * @param numThreads : The number of threads sorting in memory (0 uses every core).
+         * @throws std::invalid_argument if the memory budget is not positive.
+         */
+        TraceSorter(long memoryMegabytes = DEFAULT_SORT_MEMORY, unsigned numThreads = 0);
+
+        /**
+         * Sorts the input file into the output file. The temporary files of the runs are deleted at the end, even if the
+         * sort fails.
+         * @param inputFile : The name of the file to be sorted.
+         * @param outputFile : The name of the sorted file to be written.
+         */
+        void sort(const std::string& inputFile, const std::string& outputFile) const;
+
+};
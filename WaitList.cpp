@@ -5,9 +5,27 @@
 
 #include "WaitList.h"
 #include "Plane.h"
+#include "BinaryIO.h"
+
+/**
+ * Constructs an empty WaitList.
+ */
+WaitList::WaitList() {}
+
+/**
+ * Constructs a deep copy of the input WaitList, with the planes kept in the same order.
+ * @param other : The wait list to be copied.
+ */
+WaitList::WaitList(const WaitList& other) {
+
+    std::vector<PlaneNode *> nodes; //The nodes of the other wait list, front first
+    other.queue.inOrder(nodes);
+
+    //Adds a copy of every plane:
+    for (size_t i = 0; i < nodes.size(); i++) {
+        queue.push(new PlaneNode(nodes[i]->getPlane()));
+    }
 
-WaitList::WaitList() {
-    this->head = nullptr;
 }
 
 /**
@@ -53,41 +71,27 @@ static bool samePriority(const Plane& plane1, const Plane& plane2) {
 }
 
 /**
- * First while loop condition to traverse. The condition evaluates to true if the input plane has lower priority
- * compared to the plane stored in currentNode and the currentNode is not null.
- * @param plane : the input plane to be evaluated.
- * @param currentNode : the current node data to be evaluated.
- * @return true if the currentNode is not null and the input plane has lower priority to the plane stored in this node.
+ * Orders the nodes of the wait list by the priority given in the class' information.
+ * @param node1 : first input node
+ * @param node2 : second input node
+ * @return true if the plane of the first node has strictly higher priority than the plane of the second node.
  */
-static bool firstTraversal(const Plane& plane, PlaneNode *currentNode) {
-	return currentNode != nullptr && lowerPriority(plane, currentNode->getPlane());
-}
+bool WaitList::Before::operator()(const PlaneNode& node1, const PlaneNode& node2) const {
 
-/**
- * Second while loop condition to traverse. The condition evaluates to true if the input plane has the same priority but
- * later request time compared to the plane stored in currentNode and the currentNode is not null.
- * @param plane : the input plane to be evaluated.
- * @param currentNode : the current node data to be evaluated.
- * @return true if the currentNode is not null and the input plane has the same priority but later request time
- * compared to the plane stored in this node.
- */
-static bool secondTraversal(const Plane& plane, PlaneNode *currentNode) {
-	return currentNode != nullptr && compareTime(plane, currentNode->getPlane()) > 0 
-        && samePriority(plane, currentNode->getPlane());
-}
+    const Plane& plane1 = node1.getPlane();
+    const Plane& plane2 = node2.getPlane();
+
+    //Landings always come first:
+    if (!samePriority(plane1, plane2)) {
+        return lowerPriority(plane2, plane1);
+    }
+
+    //Same request type: the earlier request comes first, then the lower ATC ID:
+    if (compareTime(plane1, plane2) != 0) {
+        return compareTime(plane1, plane2) < 0;
+    }
+    return compareID(plane1, plane2) < 0;
 
-/**
- * Final while loop condition to traverse. The condition evaluates to true if the input plane has the same priority,
- * same request time but higher ATC ID compared to the plane stored in currentNode and the currentNode is not null.
- * @param plane : the input plane to be evaluated.
- * @param currentNode : the current node data to be evaluated.
- * @return true if the currentNode is not null and the input plane has the same priority and same request time but
- * higher ATC ID compared to the plane stored in this node.
- */
-static bool finalTraversal(const Plane& plane, PlaneNode *currentNode) {
-	return currentNode != nullptr && compareTime(plane, currentNode->getPlane()) == 0 
-		&& samePriority(plane, currentNode->getPlane())
-		&& compareID(plane, currentNode->getPlane()) > 0;
 }
 
 /**
@@ -98,53 +102,8 @@ static bool finalTraversal(const Plane& plane, PlaneNode *currentNode) {
  */
 bool WaitList::enqueue(const Plane &plane) {
 
-    //Allocates the memory for the new node:
-    PlaneNode *node = new PlaneNode(plane);
-
-    if (this->isEmpty()) {
-
-        //If the list is empty, proceeds to set the front node directly:
-        this->head = node;
-
-    } else {
-
-        PlaneNode* curr = head; //Current node
-        PlaneNode* prev = nullptr; //Previous node
-
-        //First while loop:
-		while (firstTraversal(plane, curr)) {
-			prev = curr;
-			curr = curr->getNext();
-		}
-
-        //Second while loop:
-		while (secondTraversal(plane, curr)) {
-            prev = curr;
-            curr = curr->getNext();
-        }
-
-        //Final while loop:
-		while (finalTraversal(plane, curr)) {
-            prev = curr;
-            curr = curr->getNext();
-        }
-
-
-		if (prev == nullptr) {
-
-            //If the index of insertion is at the front, proceeds to set newNode as head.
-            node->setNext(head);
-            head = node;
-
-        } else {
-
-            //Puts the node in between prev and curr:
-            node->setNext(curr);
-            prev->setNext(node);
-
-        }
-
-    }
+    //Allocates the memory for the new node, then lets the queue link it at its spot:
+    queue.push(new PlaneNode(plane));
 
     //Returns true by default:
     return true;
@@ -156,23 +115,22 @@ bool WaitList::enqueue(const Plane &plane) {
  * @return The plane at the front.
  */
 const Plane& WaitList::peek() const {
-    return this->head->getPlane();
+    return queue.top()->getPlane();
 }
 
 /**
- * Removes the first plane in this queue. A copy reference of this plane is returned.
+ * Removes the first plane in this queue. A copy of this plane is returned.
  * @return The plane removed at the front.
  */
-Plane& WaitList::dequeue() {
+Plane WaitList::dequeue() {
 
-    static Plane plane; //The plane object to be returned
+    Plane plane; //The plane object to be returned
 
     //If this queue is non-empty:
     if (!this->isEmpty()) {
 
-        //Creates a temporary node, then shifts front:
-        PlaneNode* temp = head;
-        head = head->getNext();
+        //Removes the front node from the queue:
+        PlaneNode* temp = queue.pop();
 
         //Creates a copy of this plane, then deletes this temp node:
         plane = temp->getPlane();
@@ -190,43 +148,63 @@ Plane& WaitList::dequeue() {
  * @return true if this queue is empty, false otherwise.
  */
 bool WaitList::isEmpty() {
-    return this->head == nullptr;
+    return queue.empty();
 }
 
 /**
- * Prints out the queue in the pattern from front to back. Used for debugging purposes only.
+ * Writes every plane of this wait list in binary form, from front to back (see Plane::write(std::ostream&)).
+ * @param out : The binary output stream.
  */
-void WaitList::debug() {
+void WaitList::write(std::ostream& out) const {
 
-    PlaneNode *current = this->head; //Current node
+    std::vector<PlaneNode *> nodes; //The nodes of this wait list, front first
+    queue.inOrder(nodes);
 
-    //While loop to prints the list information onto the console:
-    while (current != nullptr) {
-        std::cout << current->getPlane() << std::endl;
-        current = current->getNext();
+    BinaryIO::writeInt(out, nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        nodes[i]->getPlane().write(out);
     }
 
 }
 
 /**
- * Deallocates the queue back to the memory. Before the queue itself is deallocated, the nodes
- * within this queue are freed sequentially first.
+ * Reads the planes written by WaitList::write(std::ostream&) into this wait list, which must be empty.
+ * @param in : The binary input stream.
  */
-WaitList::~WaitList() {
+void WaitList::read(std::istream& in) {
 
-    PlaneNode *current = this->head; //Current node
-    PlaneNode *next = nullptr; //Next node
+    int count = BinaryIO::readInt(in); //The number of planes to be read
 
-    //While loop to delete all the nodes:
-    while (current != nullptr) {
+    for (int i = 0; i < count; i++) {
+        queue.push(new PlaneNode(Plane::read(in)));
+    }
 
-        //Assigns next to next node from current:
-        next = current->getNext();
+}
 
-        //Deletes the current node, then traverse to the next node:
-        delete current;
-        current = next;
+/**
+ * Prints out the queue in the pattern from front to back. Used for debugging purposes only.
+ */
+void WaitList::debug() {
+
+    std::vector<PlaneNode *> nodes; //The nodes of this wait list, front first
+    queue.inOrder(nodes);
 
+    //For loop to prints the list information onto the console:
+    for (size_t i = 0; i < nodes.size(); i++) {
+        std::cout << nodes[i]->getPlane() << std::endl;
     }
 
 }
+
+/**
+ * Deallocates the queue back to the memory. Before the queue itself is deallocated, the nodes
+ * within this queue are freed sequentially first.
+ */
+WaitList::~WaitList() {
+
+    //Deletes every node left:
+    while (!queue.empty()) {
+        delete queue.pop();
+    }
+
+}
\ No newline at end of file
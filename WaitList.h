@@ -1,6 +1,7 @@
 #pragma once
 
 #include "PlaneNode.h"
+#include "PriorityQueue.h"
 
 /**
  * The wait list used to keep track of each plane, backed by a priority queue implementation. 
@@ -13,6 +14,9 @@
  * 
  *      - If both planes share the same time and have the same request type, the order in ID assigned by the Air Traffic 
  *      Control for each plane is considered in ascending order.
+ *
+ * The planes are kept in a PriorityQueue of PlaneNodes backed by a pairing heap, since the line can grow to thousands of
+ * planes when the runways are saturated: a plane joins it in constant time instead of walking past every plane ahead.
  * 
  * @author Student name: Duc Cam Thai Student number: 7851908.
  */
@@ -20,7 +24,14 @@ class WaitList {
 
     private:
     
-        PlaneNode *head; //The front of this queue (updated from each dequeue call).
+        /**
+         * Orders the nodes of the wait list by the priority given in the class' information.
+         */
+        struct Before {
+            bool operator()(const PlaneNode& node1, const PlaneNode& node2) const;
+        };
+
+        PriorityQueue<PlaneNode, Before, PairingHeap> queue; //The nodes of the planes waiting.
 
     public:
 
@@ -28,6 +39,11 @@ class WaitList {
          * Constructs an empty WaitList.
          */
         WaitList();
+        /**
+         * Constructs a deep copy of the input WaitList, with the planes kept in the same order.
+         * @param other : The wait list to be copied.
+         */
+        WaitList(const WaitList& other);
 
         /**
          * Adds the plane into this wait list. The priority is given in the class' information. It traverses
@@ -44,16 +60,26 @@ class WaitList {
         const Plane &peek() const;
 
         /**
-         * Removes the first plane in this queue. A copy reference of this plane is returned.
+         * Removes the first plane in this queue. A copy of this plane is returned.
          * @return The plane removed at the front.
          */
-        Plane &dequeue();
+        Plane dequeue();
 
         /**
          * Indicates if this queue is empty or not.
          * @return true if this queue is empty, false otherwise.
          */
         bool isEmpty();
+        /**
+         * Writes every plane of this wait list in binary form, from front to back (see Plane::write(std::ostream&)).
+         * @param out : The binary output stream.
+         */
+        void write(std::ostream& out) const;
+        /**
+         * Reads the planes written by WaitList::write(std::ostream&) into this wait list, which must be empty.
+         * @param in : The binary input stream.
+         */
+        void read(std::istream& in);
 
         /**
          * Prints out the queue in the pattern from front to back. Used for debugging purposes only.
@@ -0,0 +1,47 @@
+/**
+ * This file is the implementation of the WakeSignal.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "WakeSignal.h"
+
+/**
+ * Constructs a signal without any waiting thread.
+ */
+WakeSignal::WakeSignal() : sleepers(0) {}
+
+/**
+ * Registers the calling thread as a sleeper, so that the next notify() takes the lock.
+ */
+void WakeSignal::enter() {
+
+    //The fence pairs with the one of notify(): either the notifying thread sees this sleeper, or the condition checked
+    //right after (under the lock) sees the change that it made.
+    sleepers.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+}
+
+/**
+ * Unregisters the calling thread as a sleeper.
+ */
+void WakeSignal::leave() {
+    sleepers.fetch_sub(1, std::memory_order_relaxed);
+}
+
+/**
+ * Wakes every thread waiting on this signal up. Must be called after every change that can make their condition
+ * true, once the change is visible to the other threads.
+ */
+void WakeSignal::notify() {
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleepers.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+
+    //Taking the lock makes sure that a sleeper that has just checked its condition is really asleep before the wake-up:
+    std::lock_guard<std::mutex> lock(mutex);
+    condition.notify_all();
+
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+constexpr auto WAKE_SPIN_LIMIT = 64; //The number of times a condition is checked before the waiting thread goes to sleep.
+
+/**
+ * Lets a thread wait for a condition on the lock-free rings (a request to pop, a free slot to push into) without burning
+ * a core: the waiting thread checks the condition a few times, then sleeps on a condition variable until the thread
+ * changing the condition rings this signal. Ringing it only takes the lock when a thread is actually asleep, so the
+ * rings stay lock-free as long as nobody waits.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class WakeSignal {
+
+    private:
+
+        std::mutex mutex; //Guards the sleep of the waiting threads.
+        std::condition_variable condition; //Wakes the sleeping threads up.
+        std::atomic<int> sleepers; //The number of threads asleep (or about to be) on this signal.
+
+        /**
+         * Registers the calling thread as a sleeper, so that the next notify() takes the lock.
+         */
+        void enter();
+
+        /**
+         * Unregisters the calling thread as a sleeper.
+         */
+        void leave();
+
+    public:
+
+        /**
+         * Constructs a signal without any waiting thread.
+         */
+        WakeSignal();
+
+        /**
+         * Wakes every thread waiting on this signal up. Must be called after every change that can make their condition
+         * true, once the change is visible to the other threads.
+         */
+        void notify();
+
+        /**
+         * Waits until the condition holds. The condition is checked a few times, then the calling thread sleeps until the
+         * signal is rung. It may be checked again at any time, so it must not have side effects unless they are only made
+         * once it holds.
+         * @param ready : The condition, a callable returning true once the thread can go on.
+         */
+        template <typename Condition>
+        void wait(Condition ready) {
+            for (int i = 0; i < WAKE_SPIN_LIMIT; i++) {
+                if (ready()) {
+                    return;
+                }
+                std::this_thread::yield();
+            }
+            enter();
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, ready);
+            lock.unlock();
+            leave();
+        }
+
+        /**
+         * Waits until the condition holds or the deadline passes, whichever comes first (see wait(Condition)).
+         * @param ready : The condition, a callable returning true once the thread can go on.
+         * @param deadline : The time after which the thread goes on anyway.
+         * @return true if the condition holds, false if the deadline passed first.
+         */
+        template <typename Condition>
+        bool waitUntil(Condition ready, std::chrono::steady_clock::time_point deadline) {
+            for (int i = 0; i < WAKE_SPIN_LIMIT; i++) {
+                if (ready()) {
+                    return true;
+                }
+                if (std::chrono::steady_clock::now() >= deadline) {
+                    return false;
+                }
+                std::this_thread::yield();
+            }
+            enter();
+            std::unique_lock<std::mutex> lock(mutex);
+            bool result = condition.wait_until(lock, deadline, ready);
+            lock.unlock();
+            leave();
+            return result;
+        }
+
+};
@@ -0,0 +1,57 @@
+/**
+ * This file is the implementation of the WindowRequestSource.h blueprint.
+ * @author: Student name: Duc Cam Thai, Student number: 7851908
+ */
+
+#include "WindowRequestSource.h"
+
+/**
+ * Constructs the window over the given feed.
+ * @param upstream : The feed sorted by request time. This source takes ownership of it.
+ * @param start : The time of the first request let through.
+ * @param end : The end of the window (the requests made at or after it are not let through).
+ */
+WindowRequestSource::WindowRequestSource(RequestSource *upstream, int start, int end) {
+    this->upstream = upstream;
+    this->start = start;
+    this->end = end;
+    ended = false;
+}
+
+/**
+ * Retrieves the next request of the feed made within the window.
+ * @param plane : The plane receiving the next request.
+ * @return true if a request was retrieved, false if the end of the window is reached.
+ */
+bool WindowRequestSource::next(Plane& plane) {
+
+    //Skips the requests made before the window:
+    while (!ended && upstream->next(plane)) {
+        if (plane.getRequestTime() >= end) {
+            ended = true;
+        } else if (plane.getRequestTime() >= start) {
+            return true;
+        }
+    }
+
+    ended = true;
+    return false;
+
+}
+
+/**
+ * Creates a window over a copy of the feed (see RequestSource::fork()).
+ * @return The heap-allocated copy, owned by the caller.
+ */
+RequestSource *WindowRequestSource::fork() const {
+    WindowRequestSource *copy = new WindowRequestSource(upstream->fork(), start, end);
+    copy->ended = ended;
+    return copy;
+}
+
+/**
+ * Deletes the upstream feed.
+ */
+WindowRequestSource::~WindowRequestSource() {
+    delete upstream;
+}
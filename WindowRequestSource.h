@@ -0,0 +1,48 @@
+#pragma once
+
+#include "RequestSource.h"
+
+/**
+ * Only lets through the requests of a feed made within a time window. The requests made before the window are skipped
+ * (their ATC IDs are kept as they are, so the IDs stay the same as in the whole feed), and the feed is considered
+ * finished at the first request made at or after the end of the window. The feed must be sorted by request time.
+ * @author Student name: Duc Cam Thai Student number: 7851908
+ */
+class WindowRequestSource : public RequestSource {
+
+    private:
+
+        RequestSource *upstream; //The whole feed (owned by this source).
+        int start; //The time of the first request let through.
+        int end; //The end of the window (the requests made at or after it are not let through).
+        bool ended; //Whether a request at or after the end of the window has been read.
+
+    public:
+
+        /**
+         * Constructs the window over the given feed.
+         * @param upstream : The feed sorted by request time. This source takes ownership of it.
+         * @param start : The time of the first request let through.
+         * @param end : The end of the window (the requests made at or after it are not let through).
+         */
+        WindowRequestSource(RequestSource *upstream, int start, int end);
+
+        /**
+         * Retrieves the next request of the feed made within the window.
+         * @param plane : The plane receiving the next request.
+         * @return true if a request was retrieved, false if the end of the window is reached.
+         */
+        bool next(Plane& plane) override;
+
+        /**
+         * Creates a window over a copy of the feed (see RequestSource::fork()).
+         * @return The heap-allocated copy, owned by the caller.
+         */
+        RequestSource *fork() const override;
+
+        /**
+         * Deletes the upstream feed.
+         */
+        ~WindowRequestSource() override;
+
+};